@@ -2,8 +2,8 @@
 #include <tyga/Actor.hpp>
 #include <tyga/ActorWorld.hpp>
 #include <tyga/GraphicsCentre.hpp>
-#include <tyga/Log.hpp>
 #include <tyga/Math.hpp>
+#include <Physics/ParticleEmitter.hpp>
 #include <Physics/PhysicsSystem.hpp>
 #include <Physics/PhysicsSphere.hpp>
 #include <Utility/Tyga.hpp>
@@ -25,7 +25,10 @@ namespace spc
     {
         if (this != &move)
         {
-            m_collider = std::move (move.m_collider);
+            m_model     = std::move (move.m_model);
+            m_collider  = std::move (move.m_collider);
+            m_explosion = std::move (move.m_explosion);
+            m_exploded  = move.m_exploded;
         }
 
         return *this;
@@ -62,16 +65,44 @@ namespace spc
     void ToyMine::applyForce (const tyga::Vector3& force)
     {
         // NB: this method should not need changing
-        m_collider->force += force;
-        m_collider->velocity = tyga::Vector3(0,0,0);
+        m_collider->addForce (force);
+        m_collider->setVelocity (tyga::Vector3(0,0,0));
     }
 
 
     void ToyMine::trigger()
     {
-        // TODO: code to begin the explosion animation/simulation
-        tyga::debugLog("ToyMine::trigger: toy should explode now");
-        removeFromWorld();
+        // A mine can be hit several times in one tick but only explodes once.
+        if (m_exploded)
+        {
+            return;
+        }
+
+        m_exploded = true;
+
+        // The debris is simulated by the particle system rather than as components of the mine.
+        ParticleEmitter::Settings settings { };
+        settings.capacity   = 600;
+        settings.lifetime   = 2.5f;
+        settings.minSpeed   = 3.f;
+        settings.maxSpeed   = 9.f;
+        settings.seed       = m_collider->getID();
+
+        const auto physics = PhysicsSystem::defaultSystem();
+        m_explosion = physics->getParticles().createEmitter (settings);
+        m_explosion->emit (m_collider->position(), settings.capacity);
+
+        // The blast pushes away nearby mines but not the mine itself. The Badger is static so it stands its ground.
+        physics->applyRadialImpulse (m_collider->position(), 3.f, 6.f, PhysicsSystem::Falloff::Linear, m_collider.get());
+
+        // The mine stays in the world until its debris has gone, so hide it and take its collider out of the simulation
+        // from the next tick. The callback is left in place as this may be running inside it.
+        m_model->xform = tyga::Matrix4x4 (0, 0, 0, 0,
+                                          0, 0, 0, 0,
+                                          0, 0, 0, 0,
+                                          0, 0, 0, 1);
+
+        m_collider->setEnabled (false);
     }
 
 
@@ -97,6 +128,8 @@ namespace spc
         auto physics_model = physics->createObject<spc::PhysicsSphere>();
         physics_model->radius = 0.25f;
         physics_model->setMass (1.f);
+        physics_model->setContinuous (true);
+        m_model = graphics_model;
         m_collider = physics_model;
         m_collider->onCollide = [&] (PhysicsObject& object) { onCollision (object); };
 
@@ -112,7 +145,11 @@ namespace spc
 
     void ToyMine::actorClockTick (std::shared_ptr<tyga::Actor> actor)
     {
-        // HINT: once the toy has exploded and there is no visible traces left
-        //       then call this->removeFromWorld() to free the memory
+        // The emitter knows how many particles are alive, so there's nothing to scan.
+        if (m_explosion && m_explosion->isEmpty())
+        {
+            m_explosion = nullptr;
+            removeFromWorld();
+        }
     }
 }
\ No newline at end of file
@@ -7,13 +7,14 @@
 
 
 // Forward declarations.
-namespace tyga { class Vector3; }
+namespace tyga { class GraphicsModel; class Vector3; }
 class Badger;
 
 
 namespace spc
 {
     // Forward declarations.
+    class ParticleEmitter;
     class PhysicsObject;
     class PhysicsSphere;
 
@@ -87,7 +88,10 @@ namespace spc
             // Internal data //
             ///////////////////
 
-            std::shared_ptr<spc::PhysicsSphere> m_collider  { nullptr };    //!< The collider of the mine.
+            std::shared_ptr<tyga::GraphicsModel>    m_model     { nullptr };    //!< The visible sphere, hidden once the mine explodes.
+            std::shared_ptr<spc::PhysicsSphere>     m_collider  { nullptr };    //!< The collider of the mine.
+            std::shared_ptr<spc::ParticleEmitter>   m_explosion { nullptr };    //!< The debris of the mine, the mine leaves the world once it's empty.
+            bool                                    m_exploded  { false };      //!< Whether the mine has been triggered, it only explodes once.
     };
 }
 
@@ -22,7 +22,7 @@ MyDemo::
 MyDemo()
 {
     camera_mode_ = kCameraStatic;
-    trigger_time_ = std::numeric_limits<float>::max();
+    trigger_tick_ = std::numeric_limits<std::uint64_t>::max();
 }
 
 void MyDemo::
@@ -53,12 +53,17 @@ applicationDidStart()
     tyga::Application::addRunloopTask(tyga::GraphicsCentre::defaultCentre());
     tyga::Application::addRunloopTask(tyga::ActorWorld::defaultWorld());
 
-    tyga::Application::setRunloopFrequency(60);
+    tyga::Application::setRunloopFrequency(kTicksPerSecond);
 
 
     auto world = tyga::ActorWorld::defaultWorld();
     auto graphics = tyga::GraphicsCentre::defaultCentre();
     auto physics = spc::PhysicsSystem::defaultSystem();
+    physics->setFixedTimestep(true);
+
+    // Replays of a session only need the seed, every random value comes from the physics system.
+    physics->setDeterministic(true);
+    physics->setSeed(kRandomSeed);
 
 
     auto floor_mesh = graphics->newMeshWithIdentifier("cube");
@@ -71,7 +76,7 @@ applicationDidStart()
     auto floor_actor = std::make_shared<tyga::Actor>();
     floor_actor->attachComponent(floor_model);
     auto floor_plane = physics->createObject<spc::PhysicsPlane>();
-    floor_plane->isStatic = true;
+    floor_plane->setStatic(true);
     floor_actor->attachComponent (floor_plane);
     auto floor_xform = tyga::Matrix4x4(      40,       0,       0,       0,
                                               0,    0.2f,       0,       0,
@@ -89,7 +94,7 @@ applicationDidStart()
 
     badger_ = Badger::makeBadgerWithBloke(world);
     auto badger_box = physics->createObject<spc::PhysicsSphere>();
-    badger_box->isStatic = true;
+    badger_box->setStatic(true);
     badger_box->radius = 1.5f;
     badger_box->name = "Badger";
     badger_->boundsActor()->attachComponent(badger_box);
@@ -104,12 +109,13 @@ applicationRunloopWillBegin()
 {
     tyga::BasicWorldClock::update();
 
-    const float time = tyga::BasicWorldClock::CurrentTime();
-    if (trigger_time_ < time) {
+    // Ticks rather than the clock decide when the toys explode so replays trigger them on the same tick.
+    const auto tick = spc::PhysicsSystem::defaultSystem()->getTickCount();
+    if (trigger_tick_ <= tick) {
         for (auto toy : toys_) {
             toy->trigger();
         }
-        trigger_time_ = std::numeric_limits<float>::max();
+        trigger_tick_ = std::numeric_limits<std::uint64_t>::max();
     }
 
     auto camera_xform = tyga::Matrix4x4(       1,       0,       0,       0,
@@ -210,6 +216,7 @@ resetToys()
     std::uniform_real_distribution<float> m_rand(0.5f, 1.5f);
 
     auto world = tyga::ActorWorld::defaultWorld();
+    auto& rand = spc::PhysicsSystem::defaultSystem()->getRandom();
 
     toys_.resize(n_rand(rand));
     for (auto& toy : toys_) {
@@ -226,6 +233,7 @@ triggerToys()
 {
     std::uniform_real_distribution<float> x_rand(-0.2f, 0.2f);
     std::uniform_real_distribution<float> z_rand(-0.2f, 0.2f);
+    auto& rand = spc::PhysicsSystem::defaultSystem()->getRandom();
 
     for (auto toy : toys_) {
         auto dir = tyga::unit(tyga::Vector3(x_rand(rand), 1, z_rand(rand)));
@@ -233,6 +241,6 @@ triggerToys()
         toy->applyForce(force);
     }
 
-    std::uniform_real_distribution<float> t_rand(1, 3);
-    trigger_time_ = tyga::BasicWorldClock::CurrentTime() + t_rand(rand);
+    std::uniform_int_distribution<int> t_rand(kTicksPerSecond, 3 * kTicksPerSecond);
+    trigger_tick_ = spc::PhysicsSystem::defaultSystem()->getTickCount() + t_rand(rand);
 }
@@ -3,6 +3,7 @@
 #include <tyga/Math.hpp>
 #include <tyga/ApplicationDelegate.hpp>
 #include <tyga/GraphicsRendererProtocol.hpp>
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -54,11 +55,12 @@ private:
     std::shared_ptr<Camera> camera_;
     std::shared_ptr<Badger> badger_;
 
-    std::minstd_rand rand;
+    static const unsigned int kRandomSeed = 1;
+    static const int kTicksPerSecond = 60;
     static const tyga::Vector3 MIN_BOUND;
     static const tyga::Vector3 MAX_BOUND;
 
     std::vector<std::shared_ptr<spc::ToyMine>> toys_;
 
-    float trigger_time_;
+    std::uint64_t trigger_tick_;
 };
@@ -0,0 +1,113 @@
+// STL headers.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/PhysicsPlane.hpp>
+#include <Physics/PhysicsSphere.hpp>
+#include <Physics/PhysicsSystem.hpp>
+
+
+namespace
+{
+    /// <summary> Creates an actor at the given position with a new physics object attached to it. </summary>
+    /// <param name="system"> The system to create the object in. </param>
+    /// <param name="actors"> Keeps the actor alive for the duration of the run. </param>
+    /// <param name="position"> The starting position of the actor. </param>
+    /// <returns> The attached object. </returns>
+    template <typename T> std::shared_ptr<T> addObject (spc::PhysicsSystem& system,
+        std::vector<std::shared_ptr<spc::EngineActor>>& actors, const math::Vector3& position)
+    {
+        auto transform  = math::Matrix4x4();
+        transform._30   = position.x;
+        transform._31   = position.y;
+        transform._32   = position.z;
+
+        auto actor  = std::make_shared<spc::EngineActor>();
+        auto object = system.createObject<T>();
+        actor->setTransformation (transform);
+        actor->attachComponent (object);
+        actors.push_back (actor);
+
+        return object;
+    }
+}
+
+
+/// <summary>
+/// Drops a grid of spheres onto a static plane without a window or renderer and reports how long it took, which makes
+/// the physics core easy to profile and compare between machines.
+/// Usage: HeadlessSimulation [spheres = 1000] [frames = 600] [workers = 0]
+/// </summary>
+int main (int argc, char* argv[])
+{
+    const auto sphereCount  = argc > 1 ? std::atoi (argv[1]) : 1000;
+    const auto frameCount   = argc > 2 ? std::atoi (argv[2]) : 600;
+    const auto workerCount  = argc > 3 ? std::atoi (argv[3]) : 0;
+
+    // Every frame is the same length so runs can be compared.
+    spc::EngineClock::setTickInterval (1.f / 60.f);
+
+    auto system = std::make_shared<spc::PhysicsSystem>();
+    system->setFixedTimestep (true);
+    system->setDeterministic (true);
+    system->setWorkerCount (static_cast<unsigned int> (workerCount > 0 ? workerCount : 0));
+
+    std::vector<std::shared_ptr<spc::EngineActor>>      actors  { };
+    std::vector<std::shared_ptr<spc::PhysicsSphere>>    spheres { };
+
+    auto floor = addObject<spc::PhysicsPlane> (*system, actors, { 0.f, 0.f, 0.f });
+    floor->setStatic (true);
+
+    // Spheres are stacked in layers of a 32 by 32 grid.
+    const auto spacing = 0.6f;
+
+    for (auto i = 0; i < sphereCount; ++i)
+    {
+        const auto position = math::Vector3 ((i % 32) * spacing, 0.5f + (i / 1024) * spacing, ((i / 32) % 32) * spacing);
+
+        auto sphere     = addObject<spc::PhysicsSphere> (*system, actors, position);
+        sphere->radius  = 0.25f;
+        spheres.push_back (sphere);
+    }
+
+    // The system is driven the same way the engine runloop would drive it.
+    auto& task = static_cast<spc::EngineTask&> (*system);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (auto frame = 0; frame < frameCount; ++frame)
+    {
+        task.runloopWillBegin();
+        task.runloopExecuteTask();
+        task.runloopDidEnd();
+    }
+
+    const auto end          = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration<double, std::milli> (end - start).count();
+
+    std::printf ("%d spheres, %d frames, %u workers\n", sphereCount, frameCount, system->getWorkerCount());
+    std::printf ("Total: %.2f ms, per frame: %.4f ms\n", milliseconds, frameCount > 0 ? milliseconds / frameCount : 0.0);
+
+    // Runs with the same arguments must match on every machine and worker count.
+    std::printf ("State hash after %llu ticks: %016llx\n", static_cast<unsigned long long> (system->getTickCount()),
+                 static_cast<unsigned long long> (system->getStateHash()));
+
+    // A few final positions give a quick check that the simulation behaved.
+    const auto shown = spheres.size() < 4 ? spheres.size() : 4;
+
+    for (auto i = 0U; i < shown; ++i)
+    {
+        const auto position = spheres[i]->position();
+        std::printf ("Sphere %u: (%.4f, %.4f, %.4f)\n", i, position.x, position.y, position.z);
+    }
+
+    return 0;
+
+}
\ No newline at end of file
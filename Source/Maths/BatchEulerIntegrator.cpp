@@ -0,0 +1,136 @@
+#include "BatchEulerIntegrator.hpp"
+
+
+// STL headers.
+#include <cassert>
+
+
+// SIMD headers.
+#if defined (__AVX__)
+    #define BATCH_EULER_AVX
+    #include <immintrin.h>
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BATCH_EULER_SSE
+    #include <emmintrin.h>
+#endif
+
+
+namespace
+{
+    /// Explicit Euler moves the position by the starting velocity and the velocity by the starting acceleration:
+    ///     p += v * dt,    v += (A - k * v) * dt
+    /// Each body only moves if its motion is 1.
+
+    #if defined (BATCH_EULER_AVX)
+
+        /// <summary> Integrates eight bodies at once with AVX. </summary>
+        void integrateLanes (const BatchEulerIntegrator::Axis& axis, const BatchEulerIntegrator::Bodies& bodies,
+                             const unsigned int i, const __m256 gravity, const __m256 delta)
+        {
+            const auto negate   = _mm256_set1_ps (-0.f);
+
+            const auto position = _mm256_loadu_ps (axis.position + i);
+            const auto velocity = _mm256_loadu_ps (axis.velocity + i);
+            const auto force    = _mm256_loadu_ps (axis.force + i);
+            const auto invMass  = _mm256_loadu_ps (bodies.inverseMass + i);
+            const auto drag     = _mm256_xor_ps (_mm256_loadu_ps (bodies.drag + i), negate);
+            const auto motion   = _mm256_loadu_ps (bodies.motion + i);
+
+            const auto accel    = _mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (force, invMass), gravity), _mm256_mul_ps (velocity, drag));
+
+            const auto dp       = _mm256_mul_ps (velocity, delta);
+            const auto dv       = _mm256_mul_ps (accel, delta);
+
+            _mm256_storeu_ps (axis.position + i, _mm256_add_ps (position, _mm256_mul_ps (dp, motion)));
+            _mm256_storeu_ps (axis.velocity + i, _mm256_add_ps (velocity, _mm256_mul_ps (dv, motion)));
+        }
+
+        const unsigned int laneCount = 8;
+
+    #elif defined (BATCH_EULER_SSE)
+
+        /// <summary> Integrates four bodies at once with SSE. </summary>
+        void integrateLanes (const BatchEulerIntegrator::Axis& axis, const BatchEulerIntegrator::Bodies& bodies,
+                             const unsigned int i, const __m128 gravity, const __m128 delta)
+        {
+            const auto negate   = _mm_set1_ps (-0.f);
+
+            const auto position = _mm_loadu_ps (axis.position + i);
+            const auto velocity = _mm_loadu_ps (axis.velocity + i);
+            const auto force    = _mm_loadu_ps (axis.force + i);
+            const auto invMass  = _mm_loadu_ps (bodies.inverseMass + i);
+            const auto drag     = _mm_xor_ps (_mm_loadu_ps (bodies.drag + i), negate);
+            const auto motion   = _mm_loadu_ps (bodies.motion + i);
+
+            const auto accel    = _mm_add_ps (_mm_add_ps (_mm_mul_ps (force, invMass), gravity), _mm_mul_ps (velocity, drag));
+
+            const auto dp       = _mm_mul_ps (velocity, delta);
+            const auto dv       = _mm_mul_ps (accel, delta);
+
+            _mm_storeu_ps (axis.position + i, _mm_add_ps (position, _mm_mul_ps (dp, motion)));
+            _mm_storeu_ps (axis.velocity + i, _mm_add_ps (velocity, _mm_mul_ps (dv, motion)));
+        }
+
+        const unsigned int laneCount = 4;
+
+    #endif
+}
+
+
+//////////////////////
+// Public interface //
+//////////////////////
+
+void BatchEulerIntegrator::integrate (const Axis& axis, const Bodies& bodies, const float deltaTime)
+{
+    // Pre-condition: Every array exists, an empty batch may have none as the data of an empty vector can be nullptr.
+    assert (bodies.count == 0 || (axis.position && axis.velocity && axis.force));
+    assert (bodies.count == 0 || (bodies.inverseMass && bodies.drag && bodies.motion));
+
+    auto i = 0U;
+
+    #if defined (BATCH_EULER_AVX)
+
+        const auto gravity = _mm256_set1_ps (axis.gravity);
+        const auto delta   = _mm256_set1_ps (deltaTime);
+
+        for (; i + laneCount <= bodies.count; i += laneCount)
+        {
+            integrateLanes (axis, bodies, i, gravity, delta);
+        }
+
+    #elif defined (BATCH_EULER_SSE)
+
+        const auto gravity = _mm_set1_ps (axis.gravity);
+        const auto delta   = _mm_set1_ps (deltaTime);
+
+        for (; i + laneCount <= bodies.count; i += laneCount)
+        {
+            integrateLanes (axis, bodies, i, gravity, delta);
+        }
+
+    #endif
+
+    // Anything which doesn't fill a whole register is done one at a time.
+    integrateScalar (axis, bodies, i, deltaTime);
+}
+
+
+//////////////
+// Internal //
+//////////////
+
+void BatchEulerIntegrator::integrateScalar (const Axis& axis, const Bodies& bodies, const unsigned int first, const float deltaTime)
+{
+    for (auto i = first; i < bodies.count; ++i)
+    {
+        const auto velocity = axis.velocity[i];
+        const auto accel    = axis.force[i] * bodies.inverseMass[i] + axis.gravity + velocity * -bodies.drag[i];
+
+        const auto dp       = velocity * deltaTime;
+        const auto dv       = accel * deltaTime;
+
+        axis.position[i]    += dp * bodies.motion[i];
+        axis.velocity[i]    += dv * bodies.motion[i];
+    }
+}
\ No newline at end of file
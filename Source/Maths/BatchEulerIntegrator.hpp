@@ -0,0 +1,40 @@
+#ifndef BATCH_EULER_INTEGRATOR_HPP
+#define BATCH_EULER_INTEGRATOR_HPP
+
+
+// Personal headers.
+#include <Maths/BatchRK4Integrator.hpp>
+
+
+/// <summary>
+/// An explicit Euler integrator which steps many bodies at once over structure-of-arrays data. It uses the same model
+/// and batch layout as BatchRK4Integrator, a = force * inverseMass + gravity - drag * velocity, but only samples the
+/// acceleration once so it is roughly four times cheaper. SSE and AVX are used when available with a scalar loop
+/// handling the remainder. Every path performs the same floating point operations in the same order as EulerIntegrator.
+/// </summary>
+class BatchEulerIntegrator final
+{
+    public:
+
+        using Axis   = BatchRK4Integrator::Axis;
+        using Bodies = BatchRK4Integrator::Bodies;
+
+        /// <summary>
+        /// Using the explicit Euler method, calculate the position and velocity of every body in the batch along one axis.
+        /// </summary>
+        /// <param name="axis"> The position, velocity and force arrays of the axis to integrate. </param>
+        /// <param name="bodies"> The properties of each body. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        static void integrate (const Axis& axis, const Bodies& bodies, const float deltaTime);
+
+    private:
+
+        /// <summary> Integrates bodies using plain floating point operations, this is used for any remainder. </summary>
+        /// <param name="axis"> The arrays of the axis to integrate. </param>
+        /// <param name="bodies"> The properties of each body. </param>
+        /// <param name="first"> The index of the first body to integrate. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        static void integrateScalar (const Axis& axis, const Bodies& bodies, const unsigned int first, const float deltaTime);
+};
+
+#endif
\ No newline at end of file
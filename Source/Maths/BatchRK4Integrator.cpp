@@ -0,0 +1,188 @@
+#include "BatchRK4Integrator.hpp"
+
+
+// STL headers.
+#include <cassert>
+
+
+// SIMD headers.
+#if defined (__AVX__)
+    #define BATCH_RK4_AVX
+    #include <immintrin.h>
+#elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BATCH_RK4_SSE
+    #include <emmintrin.h>
+#endif
+
+
+namespace
+{
+    /// Each evaluation of RK4Integrator::calculate reduces to the following for a = A - k * v:
+    ///     v1 = v,                 a1 = A + v1 * -k
+    ///     v2 = v + a1 * dt / 2,   a2 = A + v2 * -k
+    ///     v3 = v + a2 * dt / 2,   a3 = A + v3 * -k
+    ///     v4 = v + a3 * dt,       a4 = A + v4 * -k
+    /// The weighted sums are then 1/6 * (x1 + 2 * (x2 + x3) + x4) * dt, each body only moves if its motion is 1.
+
+    #if defined (BATCH_RK4_AVX)
+
+        /// <summary> Integrates eight bodies at once with AVX. </summary>
+        void integrateLanes (const BatchRK4Integrator::Axis& axis, const BatchRK4Integrator::Bodies& bodies,
+                             const unsigned int i, const __m256 gravity, const __m256 halfDelta, const __m256 delta)
+        {
+            const auto two      = _mm256_set1_ps (2.f);
+            const auto sixth    = _mm256_set1_ps (1.f / 6.f);
+            const auto negate   = _mm256_set1_ps (-0.f);
+
+            const auto position = _mm256_loadu_ps (axis.position + i);
+            const auto velocity = _mm256_loadu_ps (axis.velocity + i);
+            const auto force    = _mm256_loadu_ps (axis.force + i);
+            const auto invMass  = _mm256_loadu_ps (bodies.inverseMass + i);
+            const auto drag     = _mm256_xor_ps (_mm256_loadu_ps (bodies.drag + i), negate);
+            const auto motion   = _mm256_loadu_ps (bodies.motion + i);
+
+            const auto accel    = _mm256_add_ps (_mm256_mul_ps (force, invMass), gravity);
+
+            const auto v1       = velocity;
+            const auto a1       = _mm256_add_ps (accel, _mm256_mul_ps (v1, drag));
+            const auto v2       = _mm256_add_ps (velocity, _mm256_mul_ps (a1, halfDelta));
+            const auto a2       = _mm256_add_ps (accel, _mm256_mul_ps (v2, drag));
+            const auto v3       = _mm256_add_ps (velocity, _mm256_mul_ps (a2, halfDelta));
+            const auto a3       = _mm256_add_ps (accel, _mm256_mul_ps (v3, drag));
+            const auto v4       = _mm256_add_ps (velocity, _mm256_mul_ps (a3, delta));
+            const auto a4       = _mm256_add_ps (accel, _mm256_mul_ps (v4, drag));
+
+            const auto dp       = _mm256_mul_ps (_mm256_mul_ps (sixth, _mm256_add_ps (_mm256_add_ps (v1, _mm256_mul_ps (two, _mm256_add_ps (v2, v3))), v4)), delta);
+            const auto dv       = _mm256_mul_ps (_mm256_mul_ps (sixth, _mm256_add_ps (_mm256_add_ps (a1, _mm256_mul_ps (two, _mm256_add_ps (a2, a3))), a4)), delta);
+
+            _mm256_storeu_ps (axis.position + i, _mm256_add_ps (position, _mm256_mul_ps (dp, motion)));
+            _mm256_storeu_ps (axis.velocity + i, _mm256_add_ps (velocity, _mm256_mul_ps (dv, motion)));
+        }
+
+        const unsigned int laneCount = 8;
+
+    #elif defined (BATCH_RK4_SSE)
+
+        /// <summary> Integrates four bodies at once with SSE. </summary>
+        void integrateLanes (const BatchRK4Integrator::Axis& axis, const BatchRK4Integrator::Bodies& bodies,
+                             const unsigned int i, const __m128 gravity, const __m128 halfDelta, const __m128 delta)
+        {
+            const auto two      = _mm_set1_ps (2.f);
+            const auto sixth    = _mm_set1_ps (1.f / 6.f);
+            const auto negate   = _mm_set1_ps (-0.f);
+
+            const auto position = _mm_loadu_ps (axis.position + i);
+            const auto velocity = _mm_loadu_ps (axis.velocity + i);
+            const auto force    = _mm_loadu_ps (axis.force + i);
+            const auto invMass  = _mm_loadu_ps (bodies.inverseMass + i);
+            const auto drag     = _mm_xor_ps (_mm_loadu_ps (bodies.drag + i), negate);
+            const auto motion   = _mm_loadu_ps (bodies.motion + i);
+
+            const auto accel    = _mm_add_ps (_mm_mul_ps (force, invMass), gravity);
+
+            const auto v1       = velocity;
+            const auto a1       = _mm_add_ps (accel, _mm_mul_ps (v1, drag));
+            const auto v2       = _mm_add_ps (velocity, _mm_mul_ps (a1, halfDelta));
+            const auto a2       = _mm_add_ps (accel, _mm_mul_ps (v2, drag));
+            const auto v3       = _mm_add_ps (velocity, _mm_mul_ps (a2, halfDelta));
+            const auto a3       = _mm_add_ps (accel, _mm_mul_ps (v3, drag));
+            const auto v4       = _mm_add_ps (velocity, _mm_mul_ps (a3, delta));
+            const auto a4       = _mm_add_ps (accel, _mm_mul_ps (v4, drag));
+
+            const auto dp       = _mm_mul_ps (_mm_mul_ps (sixth, _mm_add_ps (_mm_add_ps (v1, _mm_mul_ps (two, _mm_add_ps (v2, v3))), v4)), delta);
+            const auto dv       = _mm_mul_ps (_mm_mul_ps (sixth, _mm_add_ps (_mm_add_ps (a1, _mm_mul_ps (two, _mm_add_ps (a2, a3))), a4)), delta);
+
+            _mm_storeu_ps (axis.position + i, _mm_add_ps (position, _mm_mul_ps (dp, motion)));
+            _mm_storeu_ps (axis.velocity + i, _mm_add_ps (velocity, _mm_mul_ps (dv, motion)));
+        }
+
+        const unsigned int laneCount = 4;
+
+    #endif
+}
+
+
+//////////////////////
+// Public interface //
+//////////////////////
+
+void BatchRK4Integrator::integrate (const Axis& axis, const Bodies& bodies, const float deltaTime)
+{
+    // Pre-condition: Every array exists, an empty batch may have none as the data of an empty vector can be nullptr.
+    assert (bodies.count == 0 || (axis.position && axis.velocity && axis.force));
+    assert (bodies.count == 0 || (bodies.inverseMass && bodies.drag && bodies.motion));
+
+    auto i = 0U;
+
+    #if defined (BATCH_RK4_AVX)
+
+        const auto gravity   = _mm256_set1_ps (axis.gravity);
+        const auto halfDelta = _mm256_set1_ps (deltaTime / 2);
+        const auto delta     = _mm256_set1_ps (deltaTime);
+
+        for (; i + laneCount <= bodies.count; i += laneCount)
+        {
+            integrateLanes (axis, bodies, i, gravity, halfDelta, delta);
+        }
+
+    #elif defined (BATCH_RK4_SSE)
+
+        const auto gravity   = _mm_set1_ps (axis.gravity);
+        const auto halfDelta = _mm_set1_ps (deltaTime / 2);
+        const auto delta     = _mm_set1_ps (deltaTime);
+
+        for (; i + laneCount <= bodies.count; i += laneCount)
+        {
+            integrateLanes (axis, bodies, i, gravity, halfDelta, delta);
+        }
+
+    #endif
+
+    // Anything which doesn't fill a whole register is done one at a time.
+    integrateScalar (axis, bodies, i, deltaTime);
+}
+
+
+const char* BatchRK4Integrator::instructionSet()
+{
+    #if defined (BATCH_RK4_AVX)
+        return "AVX";
+    #elif defined (BATCH_RK4_SSE)
+        return "SSE";
+    #else
+        return "Scalar";
+    #endif
+}
+
+
+//////////////
+// Internal //
+//////////////
+
+void BatchRK4Integrator::integrateScalar (const Axis& axis, const Bodies& bodies, const unsigned int first, const float deltaTime)
+{
+    const auto halfDelta = deltaTime / 2;
+    const auto sixth     = 1.f / 6.f;
+
+    for (auto i = first; i < bodies.count; ++i)
+    {
+        const auto velocity = axis.velocity[i];
+        const auto drag     = -bodies.drag[i];
+        const auto accel    = axis.force[i] * bodies.inverseMass[i] + axis.gravity;
+
+        const auto v1       = velocity;
+        const auto a1       = accel + v1 * drag;
+        const auto v2       = velocity + a1 * halfDelta;
+        const auto a2       = accel + v2 * drag;
+        const auto v3       = velocity + a2 * halfDelta;
+        const auto a3       = accel + v3 * drag;
+        const auto v4       = velocity + a3 * deltaTime;
+        const auto a4       = accel + v4 * drag;
+
+        const auto dp       = sixth * (v1 + 2 * (v2 + v3) + v4) * deltaTime;
+        const auto dv       = sixth * (a1 + 2 * (a2 + a3) + a4) * deltaTime;
+
+        axis.position[i]    += dp * bodies.motion[i];
+        axis.velocity[i]    += dv * bodies.motion[i];
+    }
+}
\ No newline at end of file
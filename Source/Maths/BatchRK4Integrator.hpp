@@ -0,0 +1,60 @@
+#ifndef BATCH_RUNGE_KUTTA_4_INTEGRATOR_HPP
+#define BATCH_RUNGE_KUTTA_4_INTEGRATOR_HPP
+
+
+/// <summary>
+/// An RK4 integrator which steps many bodies at once over structure-of-arrays data. It is specialised for the model
+/// used by the PhysicsSystem where acceleration is a constant force and gravity term minus linear drag, i.e.
+/// a = force * inverseMass + gravity - drag * velocity. Each call integrates a single axis so that every array is
+/// read contiguously; SSE and AVX are used when available with a scalar loop handling the remainder. Every path
+/// performs the same floating point operations in the same order as RK4Integrator so results match it.
+/// </summary>
+class BatchRK4Integrator final
+{
+    public:
+
+        /// <summary>
+        /// The arrays making up a single axis of a batch. Each array must contain at least 'count' elements.
+        /// </summary>
+        struct Axis final
+        {
+            float*          position    { nullptr };    //!< The position of each body, modified in place.
+            float*          velocity    { nullptr };    //!< The velocity of each body, modified in place.
+            const float*    force       { nullptr };    //!< The force applied to each body over the step.
+            float           gravity     { 0.f };        //!< The acceleration applied to every body regardless of mass.
+        };
+
+        /// <summary>
+        /// The per-body values shared by every axis.
+        /// </summary>
+        struct Bodies final
+        {
+            const float*    inverseMass { nullptr };    //!< The reciprocal of the mass of each body.
+            const float*    drag        { nullptr };    //!< The drag co-efficient of each body.
+            const float*    motion      { nullptr };    //!< 1 for bodies which should move and 0 for those which shouldn't.
+            unsigned int    count       { 0 };          //!< How many bodies are in the batch.
+        };
+
+        /// <summary>
+        /// Using the RK4 method, calculate the position and velocity of every body in the batch along one axis.
+        /// </summary>
+        /// <param name="axis"> The position, velocity and force arrays of the axis to integrate. </param>
+        /// <param name="bodies"> The properties of each body. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        static void integrate (const Axis& axis, const Bodies& bodies, const float deltaTime);
+
+        /// <summary> Gets the name of the instruction set the batch kernel was compiled for. </summary>
+        /// <returns> "AVX", "SSE" or "Scalar". </returns>
+        static const char* instructionSet();
+
+    private:
+
+        /// <summary> Integrates bodies using plain floating point operations, this is used for any remainder. </summary>
+        /// <param name="axis"> The arrays of the axis to integrate. </param>
+        /// <param name="bodies"> The properties of each body. </param>
+        /// <param name="first"> The index of the first body to integrate. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        static void integrateScalar (const Axis& axis, const Bodies& bodies, const unsigned int first, const float deltaTime);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef ENGINE_MATH_HPP
+#define ENGINE_MATH_HPP
+
+
+/// <summary>
+/// The vector and matrix types used by the physics core, accessed through the math namespace. Normally these are the
+/// types of the tyga framework so the game and the physics share them without conversion. Defining SPC_HEADLESS
+/// replaces them with the minimal implementation below, which has the same layout and interface, so the physics core
+/// can be built without tyga.
+/// </summary>
+#if defined (SPC_HEADLESS)
+
+// STL headers.
+#include <cmath>
+
+
+namespace math
+{
+    /// <summary>
+    /// A three component vector of floats.
+    /// </summary>
+    class Vector3 final
+    {
+        public:
+
+            Vector3() = default;
+            Vector3 (const float x, const float y, const float z) : x (x), y (y), z (z) { }
+
+            Vector3& operator+= (const Vector3& rhs)    { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
+            Vector3& operator-= (const Vector3& rhs)    { x -= rhs.x; y -= rhs.y; z -= rhs.z; return *this; }
+            Vector3& operator*= (const float rhs)       { x *= rhs; y *= rhs; z *= rhs; return *this; }
+            Vector3& operator/= (const float rhs)       { x /= rhs; y /= rhs; z /= rhs; return *this; }
+
+            float x { 0.f };    //!< The X component.
+            float y { 0.f };    //!< The Y component.
+            float z { 0.f };    //!< The Z component.
+    };
+
+
+    /// <summary>
+    /// A row major 4x4 matrix of floats. Vectors are treated as rows, so the translation is stored in the last row.
+    /// </summary>
+    class Matrix4x4 final
+    {
+        public:
+
+            /// <summary> Construct an identity matrix. </summary>
+            Matrix4x4() = default;
+
+            Matrix4x4 (const float m00, const float m01, const float m02, const float m03,
+                       const float m10, const float m11, const float m12, const float m13,
+                       const float m20, const float m21, const float m22, const float m23,
+                       const float m30, const float m31, const float m32, const float m33)
+                : _00 (m00), _01 (m01), _02 (m02), _03 (m03),
+                  _10 (m10), _11 (m11), _12 (m12), _13 (m13),
+                  _20 (m20), _21 (m21), _22 (m22), _23 (m23),
+                  _30 (m30), _31 (m31), _32 (m32), _33 (m33)
+            {
+            }
+
+            float _00 { 1.f }, _01 { 0.f }, _02 { 0.f }, _03 { 0.f };
+            float _10 { 0.f }, _11 { 1.f }, _12 { 0.f }, _13 { 0.f };
+            float _20 { 0.f }, _21 { 0.f }, _22 { 1.f }, _23 { 0.f };
+            float _30 { 0.f }, _31 { 0.f }, _32 { 0.f }, _33 { 1.f };
+    };
+
+
+    inline Vector3 operator+ (Vector3 lhs, const Vector3& rhs)  { return lhs += rhs; }
+    inline Vector3 operator- (Vector3 lhs, const Vector3& rhs)  { return lhs -= rhs; }
+    inline Vector3 operator* (Vector3 lhs, const float rhs)     { return lhs *= rhs; }
+    inline Vector3 operator* (const float lhs, Vector3 rhs)     { return rhs *= lhs; }
+    inline Vector3 operator/ (Vector3 lhs, const float rhs)     { return lhs /= rhs; }
+    inline Vector3 operator- (const Vector3& vector)            { return { -vector.x, -vector.y, -vector.z }; }
+
+    /// <summary> Calculates the dot product of two vectors. </summary>
+    inline float dot (const Vector3& lhs, const Vector3& rhs)
+    {
+        return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+    }
+
+    /// <summary> Calculates the cross product of two vectors. </summary>
+    inline Vector3 cross (const Vector3& lhs, const Vector3& rhs)
+    {
+        return { lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x };
+    }
+
+    /// <summary> Calculates the length of a vector. </summary>
+    inline float length (const Vector3& vector)
+    {
+        return std::sqrt (dot (vector, vector));
+    }
+
+    /// <summary> Scales a vector to a length of one. </summary>
+    inline Vector3 unit (const Vector3& vector)
+    {
+        return vector / length (vector);
+    }
+}
+
+#else
+
+// Engine headers.
+#include <tyga/Math.hpp>
+
+
+namespace math = tyga;
+
+#endif
+
+#endif
\ No newline at end of file
@@ -2,6 +2,10 @@
 #define EULER_INTEGRATOR_HPP
 
 
+// STL headers.
+#include <functional>
+
+
 /// <summary>
 /// A simple physics integrator which makes use of the explicit Euler method for simulation.
 /// </summary>
@@ -9,6 +13,11 @@ template <typename T, typename U> class EulerIntegrator
 {
     public:
 
+        /// <summary> 
+        /// A const function which calculates acceleration when given a position, velocity and a time value.
+        /// </summary>
+        using AccelFunc = std::function<T (const T&, const T&, const U)>;
+
         /// <summary> 
         /// Uses explicit Euler to increment the position and velocity values appropriately. 
         /// </summary>
@@ -17,6 +26,30 @@ template <typename T, typename U> class EulerIntegrator
         /// <param name="acceleration"> How much the velocity is currently accelerating per second. </param>
         /// <param name="deltaTime"> The time incrementation to use. </param>
         static void integrate (T& position, T& velocity, const T& acceleration, const U deltaTime);
+
+        /// <summary> 
+        /// Uses explicit Euler to increment the position and velocity values, evaluating the acceleration at the start
+        /// of the step.
+        /// </summary>
+        /// <param name="position"> The position variable to be modified. </param>
+        /// <param name="velocity"> The velocity variable to be modified. </param>
+        /// <param name="calcAcceleration"> A simulation-dependant function which calculates acceleration at a given time point. </param>
+        /// <param name="time"> The initial time value to use for integration. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        static void integrate (T& position, T& velocity, const AccelFunc& calcAcceleration, const U time, const U deltaTime);
+
+        /// <summary> 
+        /// Uses explicit Euler to increment the position and velocity values, evaluating the acceleration at the start
+        /// of the step. The acceleration function is a template parameter so it can be inlined.
+        /// </summary>
+        /// <param name="F"> Any callable with the signature T (const T&, const T&, const U). </param>
+        /// <param name="position"> The position variable to be modified. </param>
+        /// <param name="velocity"> The velocity variable to be modified. </param>
+        /// <param name="calcAcceleration"> A simulation-dependant function which calculates acceleration at a given time point. </param>
+        /// <param name="time"> The initial time value to use for integration. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        template <typename F>
+        static void integrate (T& position, T& velocity, const F& calcAcceleration, const U time, const U deltaTime);
 };
 
 template <typename T, typename U> 
@@ -29,4 +62,20 @@ void EulerIntegrator<T, U>::integrate (T& position, T& velocity, const T& accele
     velocity += acceleration * deltaTime;
 }
 
+
+template <typename T, typename U> 
+void EulerIntegrator<T, U>::integrate (T& position, T& velocity, const AccelFunc& calcAcceleration, const U time, const U deltaTime)
+{
+    integrate<AccelFunc> (position, velocity, calcAcceleration, time, deltaTime);
+}
+
+
+template <typename T, typename U> template <typename F>
+void EulerIntegrator<T, U>::integrate (T& position, T& velocity, const F& calcAcceleration, const U time, const U deltaTime)
+{
+    // Explicit Euler only samples the acceleration once, at the start of the step.
+    const auto acceleration = calcAcceleration (position, velocity, time);
+    integrate (position, velocity, acceleration, deltaTime);
+}
+
 #endif
\ No newline at end of file
@@ -30,6 +30,20 @@ template <typename T, typename U = float> class RK4Integrator
         /// <param name="deltaTime"> The time incrementation to use. </param>
         static void integrate (T& position, T& velocity, const AccelFunc& calcAcceleration, const U time, const U deltaTime);
 
+        /// <summary> 
+        /// Using the RK4 method, calculate appropriate positon and velocity values. The acceleration function is a
+        /// template parameter so it can be inlined into each of the four evaluations, prefer this when the force
+        /// model is known at compile time.
+        /// </summary>
+        /// <param name="F"> Any callable with the signature T (const T&, const T&, const U). </param>
+        /// <param name="position"> The initial position value to be modified. </param>
+        /// <param name="velocity"> The initial velocity value to be modified. </param>
+        /// <param name="calcAcceleration"> A simulation-dependant function which calculates acceleration at a given time point. </param>
+        /// <param name="time"> The initial time value to use for integration. </param>
+        /// <param name="deltaTime"> The time incrementation to use. </param>
+        template <typename F>
+        static void integrate (T& position, T& velocity, const F& calcAcceleration, const U time, const U deltaTime);
+
     private:
 
         /// <summary>
@@ -50,11 +64,13 @@ template <typename T, typename U = float> class RK4Integrator
         /// <param name="pos"> Initial position. </param>
         /// <param name="vel"> Initial velocity. </param>
         /// <param name="prev"> The previous evalution to base the current evaluation off, this could be blank. </param>
+        /// <param name="F"> The type of the acceleration function. </param>
         /// <param name="accel"> A function to be called to calculate the acceleration of the evaluation. </param>
         /// <param name="time"> A time value to base the evaluation off. </param>
         /// <param name="delta"> The delta value to use. </param>
         /// <returns> An evaluation of velocity and acceleration after the given time point. </returns>
-        static Evaluation calculate (const T& pos, const T& vel, const Evaluation& prev, const AccelFunc& accel, const U time, const U delta);
+        template <typename F>
+        static Evaluation calculate (const T& pos, const T& vel, const Evaluation& prev, const F& accel, const U time, const U delta);
 };
 
 
@@ -64,6 +80,14 @@ template <typename T, typename U = float> class RK4Integrator
 
 template <typename T, typename U> void 
 RK4Integrator<T, U>::integrate (T& position, T& velocity, const AccelFunc& calcAcceleration, const U time, const U deltaTime)
+{
+    // The std::function is treated as any other callable, it just can't be inlined.
+    integrate<AccelFunc> (position, velocity, calcAcceleration, time, deltaTime);
+}
+
+
+template <typename T, typename U> template <typename F> void 
+RK4Integrator<T, U>::integrate (T& position, T& velocity, const F& calcAcceleration, const U time, const U deltaTime)
 {
     /// RK4 integration is a highly accurate algorithm which uses weightings to determine relatively accurate
     /// simulation values. It combines Euler calculations with Taylor series weighting. It could be 
@@ -97,8 +121,8 @@ RK4Integrator<T, U>::integrate (T& position, T& velocity, const AccelFunc& calcA
 }
 
 
-template <typename T, typename U> typename RK4Integrator<T, U>::Evaluation
-RK4Integrator<T, U>::calculate (const T& pos, const T& vel, const Evaluation& prev, const AccelFunc& accel, const U time, const U delta)
+template <typename T, typename U> template <typename F> typename RK4Integrator<T, U>::Evaluation
+RK4Integrator<T, U>::calculate (const T& pos, const T& vel, const Evaluation& prev, const F& accel, const U time, const U delta)
 {
     // Use Euler to calculate the new position and velocity.
     const auto position = pos + prev.velocity * delta;
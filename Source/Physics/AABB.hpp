@@ -0,0 +1,92 @@
+#ifndef SPC_AABB_ASP_HPP
+#define SPC_AABB_ASP_HPP
+
+
+// STL headers.
+#include <algorithm>
+#include <limits>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// An axis-aligned bounding box in world space, used by the broadphase to quickly cull pairs of objects which
+    /// can't possibly be colliding.
+    /// </summary>
+    struct AABB final
+    {
+        math::Vector3   min { };    //!< The lowest corner of the box.
+        math::Vector3   max { };    //!< The highest corner of the box.
+
+
+        /// <summary> Creates a box which contains all of space, useful for infinite objects such as planes. </summary>
+        /// <returns> An infinitely large box. </returns>
+        static AABB infinite()
+        {
+            const auto inf = std::numeric_limits<float>::max();
+            return { { -inf, -inf, -inf }, { inf, inf, inf } };
+        }
+
+        /// <summary> Creates a box surrounding a point with the given extents on each axis. </summary>
+        /// <param name="centre"> The centre of the box. </param>
+        /// <param name="extents"> How far the box extends from the centre on each axis. </param>
+        /// <returns> The constructed box. </returns>
+        static AABB fromCentre (const math::Vector3& centre, const math::Vector3& extents)
+        {
+            return { centre - extents, centre + extents };
+        }
+
+        /// <summary> Creates the smallest box which contains both of the given boxes. </summary>
+        /// <param name="lhs"> The first box. </param>
+        /// <param name="rhs"> The second box. </param>
+        /// <returns> The combined box. </returns>
+        static AABB merge (const AABB& lhs, const AABB& rhs)
+        {
+            return { { std::min (lhs.min.x, rhs.min.x), std::min (lhs.min.y, rhs.min.y), std::min (lhs.min.z, rhs.min.z) },
+                     { std::max (lhs.max.x, rhs.max.x), std::max (lhs.max.y, rhs.max.y), std::max (lhs.max.z, rhs.max.z) } };
+        }
+
+        /// <summary> Creates a copy of the box which has been expanded by the given margin on every side. </summary>
+        /// <param name="margin"> How much to grow each side by. </param>
+        /// <returns> The expanded box. </returns>
+        AABB fattened (const float margin) const
+        {
+            const auto extra = math::Vector3 (margin, margin, margin);
+            return { min - extra, max + extra };
+        }
+
+        /// <summary> Calculates the surface area of the box, this is used as a cost heuristic when building trees. </summary>
+        /// <returns> The total area of all six faces. </returns>
+        float surfaceArea() const
+        {
+            const auto size = max - min;
+            return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        /// <summary> Checks whether the given box is entirely inside of this box. </summary>
+        /// <param name="other"> The box which may be contained. </param>
+        /// <returns> Whether the box is contained. </returns>
+        bool contains (const AABB& other) const
+        {
+            return min.x <= other.min.x && max.x >= other.max.x &&
+                   min.y <= other.min.y && max.y >= other.max.y &&
+                   min.z <= other.min.z && max.z >= other.max.z;
+        }
+
+        /// <summary> Checks whether two boxes intersect, touching boxes count as intersecting. </summary>
+        /// <param name="other"> The box to test against. </param>
+        /// <returns> Whether the boxes overlap. </returns>
+        bool overlaps (const AABB& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
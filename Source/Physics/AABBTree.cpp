@@ -0,0 +1,481 @@
+#include "AABBTree.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <utility>
+
+
+namespace spc
+{
+    ////////////////////////
+    // Static definitions //
+    ////////////////////////
+
+    const int AABBTree::nullNode;
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    AABBTree::AABBTree (const float margin)
+    {
+        setMargin (margin);
+    }
+
+
+    AABBTree::AABBTree (AABBTree&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    AABBTree& AABBTree::operator= (AABBTree&& move)
+    {
+        if (this != &move)
+        {
+            m_nodes     = std::move (move.m_nodes);
+            m_root      = move.m_root;
+            m_free      = move.m_free;
+            m_margin    = move.m_margin;
+
+            move.m_root = nullNode;
+            move.m_free = nullNode;
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    int AABBTree::createProxy (const AABB& bounds, const unsigned int userData)
+    {
+        const auto proxy = allocateNode();
+        auto& leaf       = m_nodes[proxy];
+
+        leaf.tight      = bounds;
+        leaf.fat        = bounds.fattened (m_margin);
+        leaf.userData   = userData;
+        leaf.height     = 0;
+
+        insertLeaf (proxy);
+
+        return proxy;
+    }
+
+
+    void AABBTree::destroyProxy (const int proxy)
+    {
+        // Pre-condition: The node is a leaf.
+        assert (proxy >= 0 && proxy < static_cast<int> (m_nodes.size()) && m_nodes[proxy].isLeaf());
+
+        removeLeaf (proxy);
+        freeNode (proxy);
+    }
+
+
+    bool AABBTree::moveProxy (const int proxy, const AABB& bounds)
+    {
+        // Pre-condition: The node is a leaf.
+        assert (proxy >= 0 && proxy < static_cast<int> (m_nodes.size()) && m_nodes[proxy].isLeaf());
+
+        auto& leaf = m_nodes[proxy];
+        leaf.tight = bounds;
+
+        // Nothing needs to change if the object is still inside its fat bounds.
+        if (leaf.fat.contains (bounds))
+        {
+            return false;
+        }
+
+        removeLeaf (proxy);
+        m_nodes[proxy].fat = bounds.fattened (m_margin);
+        insertLeaf (proxy);
+
+        return true;
+    }
+
+
+    void AABBTree::findPairs (std::vector<BroadphasePair>& pairs) const
+    {
+        if (m_root == nullNode)
+        {
+            return;
+        }
+
+        // The children of every branch need testing against each other.
+        int stack[64];
+        auto top = 0;
+        stack[top++] = m_root;
+
+        while (top > 0)
+        {
+            const auto& node = m_nodes[stack[--top]];
+
+            if (!node.isLeaf())
+            {
+                crossPairs (*this, node.left, *this, node.right, pairs);
+
+                assert (top + 2 <= 64);
+                stack[top++] = node.left;
+                stack[top++] = node.right;
+            }
+        }
+    }
+
+
+    void AABBTree::findPairs (const AABBTree& lhs, const AABBTree& rhs, std::vector<BroadphasePair>& pairs)
+    {
+        if (lhs.m_root != nullNode && rhs.m_root != nullNode)
+        {
+            crossPairs (lhs, lhs.m_root, rhs, rhs.m_root, pairs);
+        }
+    }
+
+
+    /////////////////////
+    // Node management //
+    /////////////////////
+
+    int AABBTree::allocateNode()
+    {
+        auto node = nullNode;
+
+        // Grow the pool if there are no free nodes.
+        if (m_free == nullNode)
+        {
+            node = static_cast<int> (m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        else
+        {
+            node   = m_free;
+            m_free = m_nodes[node].parent;
+            m_nodes[node] = Node { };
+        }
+
+        m_nodes[node].height = 0;
+
+        return node;
+    }
+
+
+    void AABBTree::freeNode (const int node)
+    {
+        m_nodes[node]        = Node { };
+        m_nodes[node].parent = m_free;
+        m_free               = node;
+    }
+
+
+    ///////////////////////
+    // Tree manipulation //
+    ///////////////////////
+
+    void AABBTree::insertLeaf (const int leaf)
+    {
+        if (m_root == nullNode)
+        {
+            m_root                  = leaf;
+            m_nodes[leaf].parent    = nullNode;
+            return;
+        }
+
+        // Descend the tree looking for the cheapest sibling according to the surface area heuristic.
+        const auto leafBounds = m_nodes[leaf].fat;
+        auto index            = m_root;
+
+        while (!m_nodes[index].isLeaf())
+        {
+            const auto& node    = m_nodes[index];
+            const auto area     = node.fat.surfaceArea();
+            const auto combined = AABB::merge (node.fat, leafBounds).surfaceArea();
+
+            // Creating a new parent here costs this much.
+            const auto cost = 2.f * combined;
+
+            // Descending further means the bounds of this node must grow.
+            const auto inheritance = 2.f * (combined - area);
+
+            const auto childCost = [&] (const int child)
+            {
+                const auto& childNode = m_nodes[child];
+                const auto merged     = AABB::merge (childNode.fat, leafBounds).surfaceArea();
+
+                return childNode.isLeaf() ? merged + inheritance : merged - childNode.fat.surfaceArea() + inheritance;
+            };
+
+            const auto leftCost  = childCost (node.left),
+                       rightCost = childCost (node.right);
+
+            if (cost < leftCost && cost < rightCost)
+            {
+                break;
+            }
+
+            index = leftCost < rightCost ? node.left : node.right;
+        }
+
+        // Create a new parent for the leaf and its sibling.
+        const auto sibling   = index;
+        const auto oldParent = m_nodes[sibling].parent;
+        const auto newParent = allocateNode();
+
+        auto& parent    = m_nodes[newParent];
+        parent.parent   = oldParent;
+        parent.fat      = AABB::merge (leafBounds, m_nodes[sibling].fat);
+        parent.height   = m_nodes[sibling].height + 1;
+        parent.left     = sibling;
+        parent.right    = leaf;
+
+        if (oldParent != nullNode)
+        {
+            auto& grandParent = m_nodes[oldParent];
+            (grandParent.left == sibling ? grandParent.left : grandParent.right) = newParent;
+        }
+
+        else
+        {
+            m_root = newParent;
+        }
+
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent    = newParent;
+
+        // Fix the heights and bounds of every ancestor.
+        refit (newParent);
+    }
+
+
+    void AABBTree::removeLeaf (const int leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = nullNode;
+            return;
+        }
+
+        const auto parent       = m_nodes[leaf].parent;
+        const auto grandParent  = m_nodes[parent].parent;
+        const auto sibling      = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+        // The sibling takes the place of the parent.
+        if (grandParent != nullNode)
+        {
+            auto& node = m_nodes[grandParent];
+            (node.left == parent ? node.left : node.right) = sibling;
+
+            m_nodes[sibling].parent = grandParent;
+            freeNode (parent);
+
+            refit (grandParent);
+        }
+
+        else
+        {
+            m_root                  = sibling;
+            m_nodes[sibling].parent = nullNode;
+            freeNode (parent);
+        }
+
+        m_nodes[leaf].parent = nullNode;
+    }
+
+
+    void AABBTree::refit (int node)
+    {
+        while (node != nullNode)
+        {
+            node = balance (node);
+
+            auto& current       = m_nodes[node];
+            const auto& left    = m_nodes[current.left];
+            const auto& right   = m_nodes[current.right];
+
+            current.height  = 1 + std::max (left.height, right.height);
+            current.fat     = AABB::merge (left.fat, right.fat);
+
+            node = current.parent;
+        }
+    }
+
+
+    int AABBTree::balance (const int iA)
+    {
+        auto& a = m_nodes[iA];
+
+        if (a.isLeaf() || a.height < 2)
+        {
+            return iA;
+        }
+
+        const auto iB = a.left,
+                   iC = a.right;
+        auto& b = m_nodes[iB];
+        auto& c = m_nodes[iC];
+
+        const auto difference = c.height - b.height;
+
+        // Rotate C up.
+        if (difference > 1)
+        {
+            const auto iF = c.left,
+                       iG = c.right;
+            auto& f = m_nodes[iF];
+            auto& g = m_nodes[iG];
+
+            // Swap A and C.
+            c.left   = iA;
+            c.parent = a.parent;
+            a.parent = iC;
+
+            if (c.parent != nullNode)
+            {
+                auto& parent = m_nodes[c.parent];
+                (parent.left == iA ? parent.left : parent.right) = iC;
+            }
+
+            else
+            {
+                m_root = iC;
+            }
+
+            // The taller grandchild stays with C.
+            if (f.height > g.height)
+            {
+                c.right  = iF;
+                a.right  = iG;
+                g.parent = iA;
+
+                a.fat    = AABB::merge (b.fat, g.fat);
+                c.fat    = AABB::merge (a.fat, f.fat);
+                a.height = 1 + std::max (b.height, g.height);
+                c.height = 1 + std::max (a.height, f.height);
+            }
+
+            else
+            {
+                c.right  = iG;
+                a.right  = iF;
+                f.parent = iA;
+
+                a.fat    = AABB::merge (b.fat, f.fat);
+                c.fat    = AABB::merge (a.fat, g.fat);
+                a.height = 1 + std::max (b.height, f.height);
+                c.height = 1 + std::max (a.height, g.height);
+            }
+
+            return iC;
+        }
+
+        // Rotate B up.
+        if (difference < -1)
+        {
+            const auto iD = b.left,
+                       iE = b.right;
+            auto& d = m_nodes[iD];
+            auto& e = m_nodes[iE];
+
+            // Swap A and B.
+            b.left   = iA;
+            b.parent = a.parent;
+            a.parent = iB;
+
+            if (b.parent != nullNode)
+            {
+                auto& parent = m_nodes[b.parent];
+                (parent.left == iA ? parent.left : parent.right) = iB;
+            }
+
+            else
+            {
+                m_root = iB;
+            }
+
+            // The taller grandchild stays with B.
+            if (d.height > e.height)
+            {
+                b.right  = iD;
+                a.left   = iE;
+                e.parent = iA;
+
+                a.fat    = AABB::merge (c.fat, e.fat);
+                b.fat    = AABB::merge (a.fat, d.fat);
+                a.height = 1 + std::max (c.height, e.height);
+                b.height = 1 + std::max (a.height, d.height);
+            }
+
+            else
+            {
+                b.right  = iE;
+                a.left   = iD;
+                d.parent = iA;
+
+                a.fat    = AABB::merge (c.fat, d.fat);
+                b.fat    = AABB::merge (a.fat, e.fat);
+                a.height = 1 + std::max (c.height, d.height);
+                b.height = 1 + std::max (a.height, e.height);
+            }
+
+            return iB;
+        }
+
+        return iA;
+    }
+
+
+    /////////////////////
+    // Pair generation //
+    /////////////////////
+
+    void AABBTree::crossPairs (const AABBTree& lhsTree, int lhs, const AABBTree& rhsTree, int rhs, std::vector<BroadphasePair>& pairs)
+    {
+        // Descend both subtrees at once, only following branches whose bounds overlap.
+        std::pair<int, int> stack[128];
+        auto top = 0;
+        stack[top++] = std::make_pair (lhs, rhs);
+
+        while (top > 0)
+        {
+            const auto current = stack[--top];
+            const auto& a      = lhsTree.m_nodes[current.first];
+            const auto& b      = rhsTree.m_nodes[current.second];
+
+            if (!a.fat.overlaps (b.fat))
+            {
+                continue;
+            }
+
+            assert (top + 2 <= 128);
+
+            if (a.isLeaf() && b.isLeaf())
+            {
+                if (a.tight.overlaps (b.tight))
+                {
+                    BroadphasePair pair { };
+                    pair.lhs = a.userData;
+                    pair.rhs = b.userData;
+                    pairs.push_back (pair);
+                }
+            }
+
+            // Split the larger node to keep the descent balanced.
+            else if (b.isLeaf() || (!a.isLeaf() && a.fat.surfaceArea() > b.fat.surfaceArea()))
+            {
+                stack[top++] = std::make_pair (a.left, current.second);
+                stack[top++] = std::make_pair (a.right, current.second);
+            }
+
+            else
+            {
+                stack[top++] = std::make_pair (current.first, b.left);
+                stack[top++] = std::make_pair (current.first, b.right);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#ifndef SPC_AABB_TREE_ASP_HPP
+#define SPC_AABB_TREE_ASP_HPP
+
+
+// STL headers.
+#include <cassert>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Broadphase.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// A dynamic bounding volume hierarchy. Each leaf stores a fattened copy of the bounds of an object, so the tree
+    /// only needs restructuring when an object escapes its fat bounds. Objects which sit still never cause any work.
+    /// The tree is kept balanced with rotations as leaves are inserted and removed.
+    /// </summary>
+    class AABBTree final
+    {
+        public:
+
+            static const int nullNode = -1; //!< Represents the absence of a node.
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            /// <summary> Construct an empty tree. </summary>
+            /// <param name="margin"> How much the bounds of each leaf are fattened by. </param>
+            AABBTree (const float margin = 0.1f);
+
+            AABBTree (AABBTree&& move);
+            AABBTree& operator= (AABBTree&& move);
+
+            AABBTree (const AABBTree& copy)             = default;
+            AABBTree& operator= (const AABBTree& copy)  = default;
+            ~AABBTree()                                 = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Inserts a new leaf into the tree. </summary>
+            /// <param name="bounds"> The tight bounds of the object. </param>
+            /// <param name="userData"> A value to be associated with the leaf. </param>
+            /// <returns> The ID of the leaf. </returns>
+            int createProxy (const AABB& bounds, const unsigned int userData);
+
+            /// <summary> Removes a leaf from the tree. </summary>
+            /// <param name="proxy"> The ID of the leaf to remove. </param>
+            void destroyProxy (const int proxy);
+
+            /// <summary>
+            /// Updates the bounds of a leaf. The leaf is only reinserted if the new bounds escape its fat bounds.
+            /// </summary>
+            /// <param name="proxy"> The ID of the leaf to move. </param>
+            /// <param name="bounds"> The new tight bounds of the object. </param>
+            /// <returns> Whether the leaf had to be reinserted. </returns>
+            bool moveProxy (const int proxy, const AABB& bounds);
+
+            /// <summary> Gets the value associated with a leaf. </summary>
+            /// <param name="proxy"> The ID of the leaf. </param>
+            /// <returns> The user data of the leaf. </returns>
+            unsigned int getUserData (const int proxy) const                        { return m_nodes[proxy].userData; }
+
+            /// <summary> Sets the value associated with a leaf. </summary>
+            /// <param name="proxy"> The ID of the leaf. </param>
+            /// <param name="userData"> The new value. </param>
+            void setUserData (const int proxy, const unsigned int userData)         { m_nodes[proxy].userData = userData; }
+
+            /// <summary> Gets the tight bounds of a leaf. </summary>
+            /// <param name="proxy"> The ID of the leaf. </param>
+            /// <returns> The bounds given when the leaf was last created or moved. </returns>
+            const AABB& getBounds (const int proxy) const                           { return m_nodes[proxy].tight; }
+
+            /// <summary> Gets the margin each leaf is fattened by. </summary>
+            /// <returns> The margin. </returns>
+            float getMargin() const                                                 { return m_margin; }
+
+            /// <summary> Sets the margin each leaf is fattened by, this only affects leaves which are reinserted. </summary>
+            /// <param name="margin"> The new margin, values below zero will be ignored. </param>
+            void setMargin (const float margin)                                     { if (margin >= 0.f) m_margin = margin; }
+
+            /// <summary> Calls the given function with the ID of every leaf whose tight bounds overlap the given box. </summary>
+            /// <param name="bounds"> The area to query. </param>
+            /// <param name="callback"> A function taking the ID of each leaf found. </param>
+            template <typename Func>
+            void query (const AABB& bounds, const Func& callback) const;
+
+            /// <summary> Outputs the user data of every pair of leaves in the tree whose tight bounds overlap. </summary>
+            /// <param name="pairs"> The vector to append pairs to. </param>
+            void findPairs (std::vector<BroadphasePair>& pairs) const;
+
+            /// <summary> Outputs the user data of every pair of leaves between two trees whose tight bounds overlap. </summary>
+            /// <param name="lhs"> The first tree. </param>
+            /// <param name="rhs"> The second tree. </param>
+            /// <param name="pairs"> The vector to append pairs to. </param>
+            static void findPairs (const AABBTree& lhs, const AABBTree& rhs, std::vector<BroadphasePair>& pairs);
+
+        private:
+
+            /// <summary>
+            /// A node in the tree. Leaves have no children, branches always have two.
+            /// </summary>
+            struct Node final
+            {
+                AABB            fat         { };            //!< The fattened bounds, branches contain the bounds of both children.
+                AABB            tight       { };            //!< The actual bounds of the object, only used by leaves.
+                int             parent      { nullNode };   //!< The parent node, or the next free node if unused.
+                int             left        { nullNode };   //!< The first child.
+                int             right       { nullNode };   //!< The second child.
+                int             height      { -1 };         //!< Leaves have a height of 0, unused nodes have a height of -1.
+                unsigned int    userData    { 0 };          //!< A value associated with a leaf.
+
+                bool isLeaf() const { return left == nullNode; }
+            };
+
+
+            /// <summary> Obtains an unused node, growing the pool if necessary. </summary>
+            /// <returns> The ID of the node. </returns>
+            int allocateNode();
+
+            /// <summary> Returns a node to the pool. </summary>
+            /// <param name="node"> The ID of the node. </param>
+            void freeNode (const int node);
+
+            /// <summary> Finds the best sibling for a leaf using the surface area heuristic and inserts it. </summary>
+            /// <param name="leaf"> The leaf to insert. </param>
+            void insertLeaf (const int leaf);
+
+            /// <summary> Detaches a leaf from the tree, the node itself is not freed. </summary>
+            /// <param name="leaf"> The leaf to remove. </param>
+            void removeLeaf (const int leaf);
+
+            /// <summary> Walks from the given node to the root, balancing and refitting the bounds of each ancestor. </summary>
+            /// <param name="node"> The node to start at. </param>
+            void refit (int node);
+
+            /// <summary> Performs a rotation on the given node if its children are unbalanced. </summary>
+            /// <param name="node"> The node to balance. </param>
+            /// <returns> The node which now occupies its position in the tree. </returns>
+            int balance (const int node);
+
+            /// <summary> Outputs every overlapping pair of leaves beneath the two given nodes. </summary>
+            /// <param name="lhsTree"> The tree containing lhs. </param>
+            /// <param name="lhs"> The first node. </param>
+            /// <param name="rhsTree"> The tree containing rhs. </param>
+            /// <param name="rhs"> The second node. </param>
+            /// <param name="pairs"> The vector to append pairs to. </param>
+            static void crossPairs (const AABBTree& lhsTree, int lhs, const AABBTree& rhsTree, int rhs, std::vector<BroadphasePair>& pairs);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<Node>   m_nodes     { };            //!< Every node in the tree, including unused ones.
+            int                 m_root      { nullNode };   //!< The root of the tree.
+            int                 m_free      { nullNode };   //!< The first node in the free list.
+            float               m_margin    { 0.1f };       //!< How much the bounds of each leaf are fattened by.
+    };
+
+
+    /////////////////////
+    // Implementations //
+    /////////////////////
+
+    template <typename Func>
+    void AABBTree::query (const AABB& bounds, const Func& callback) const
+    {
+        if (m_root == nullNode)
+        {
+            return;
+        }
+
+        // Use an explicit stack to avoid recursion.
+        int stack[64];
+        auto top = 0;
+        stack[top++] = m_root;
+
+        while (top > 0)
+        {
+            const auto& node = m_nodes[stack[--top]];
+
+            if (!node.fat.overlaps (bounds))
+            {
+                continue;
+            }
+
+            if (node.isLeaf())
+            {
+                if (node.tight.overlaps (bounds))
+                {
+                    callback (static_cast<int> (&node - m_nodes.data()));
+                }
+            }
+
+            else
+            {
+                // A balanced tree will never get close to exhausting the stack.
+                assert (top + 2 <= 64);
+                stack[top++] = node.left;
+                stack[top++] = node.right;
+            }
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "BodyStore.hpp"
+
+
+// STL headers.
+#include <cassert>
+#include <utility>
+
+
+// Personal headers.
+#include <Physics/PhysicsObject.hpp>
+
+
+namespace spc
+{
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    BodyStore::BodyStore (BodyStore&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    BodyStore& BodyStore::operator= (BodyStore&& move)
+    {
+        if (this != &move)
+        {
+            positionX   = std::move (move.positionX);
+            positionY   = std::move (move.positionY);
+            positionZ   = std::move (move.positionZ);
+            previousX   = std::move (move.previousX);
+            previousY   = std::move (move.previousY);
+            previousZ   = std::move (move.previousZ);
+            velocityX   = std::move (move.velocityX);
+            velocityY   = std::move (move.velocityY);
+            velocityZ   = std::move (move.velocityZ);
+            forceX      = std::move (move.forceX);
+            forceY      = std::move (move.forceY);
+            forceZ      = std::move (move.forceZ);
+            inverseMass = std::move (move.inverseMass);
+            drag        = std::move (move.drag);
+            restitution = std::move (move.restitution);
+            restTime    = std::move (move.restTime);
+            sleepGroup  = std::move (move.sleepGroup);
+            layers      = std::move (move.layers);
+            flags       = std::move (move.flags);
+            transforms  = std::move (move.transforms);
+            owners      = std::move (move.owners);
+            m_dead      = move.m_dead;
+
+            move.m_dead = 0;
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void BodyStore::reserve (const unsigned int count)
+    {
+        positionX.reserve (count);
+        positionY.reserve (count);
+        positionZ.reserve (count);
+        previousX.reserve (count);
+        previousY.reserve (count);
+        previousZ.reserve (count);
+        velocityX.reserve (count);
+        velocityY.reserve (count);
+        velocityZ.reserve (count);
+        forceX.reserve (count);
+        forceY.reserve (count);
+        forceZ.reserve (count);
+        inverseMass.reserve (count);
+        drag.reserve (count);
+        restitution.reserve (count);
+        restTime.reserve (count);
+        sleepGroup.reserve (count);
+        layers.reserve (count);
+        flags.reserve (count);
+        transforms.reserve (count);
+        owners.reserve (count);
+    }
+
+
+    unsigned int BodyStore::add (PhysicsObject* const owner)
+    {
+        // Pre-condition: We have an owner.
+        assert (owner);
+
+        const auto body = size();
+        resize (body + 1);
+
+        // These match the defaults a PhysicsObject has always had.
+        inverseMass[body]   = 1.f;
+        drag[body]          = 0.1f;
+        restitution[body]   = 0.5f;
+        restTime[body]      = 0.f;
+        sleepGroup[body]    = 0;
+        layers[body]        = 1;
+        flags[body]         = Alive;
+        owners[body]        = owner;
+
+        return body;
+    }
+
+
+    void BodyStore::kill (const unsigned int body)
+    {
+        // Pre-condition: The body is alive.
+        assert (body < size() && hasFlag (body, Alive));
+
+        flags[body]  = 0;
+        owners[body] = nullptr;
+        ++m_dead;
+    }
+
+
+    void BodyStore::compact()
+    {
+        // Avoid touching memory in the common case that nothing has died.
+        if (m_dead == 0)
+        {
+            return;
+        }
+
+        // Shuffle the living bodies down over the dead ones in a single pass.
+        auto write = 0U;
+
+        for (auto read = 0U; read < size(); ++read)
+        {
+            if (hasFlag (read, Alive))
+            {
+                if (read != write)
+                {
+                    moveBody (read, write);
+                }
+
+                ++write;
+            }
+        }
+
+        resize (write);
+        m_dead = 0;
+    }
+
+
+    void BodyStore::setFlag (const unsigned int body, const Flag flag, const bool value)
+    {
+        flags[body] = value ? flags[body] | flag : flags[body] & ~flag;
+    }
+
+
+    void BodyStore::setPosition (const unsigned int body, const math::Vector3& value)
+    {
+        positionX[body] = value.x;
+        positionY[body] = value.y;
+        positionZ[body] = value.z;
+    }
+
+
+    void BodyStore::setVelocity (const unsigned int body, const math::Vector3& value)
+    {
+        velocityX[body] = value.x;
+        velocityY[body] = value.y;
+        velocityZ[body] = value.z;
+    }
+
+
+    void BodyStore::setForce (const unsigned int body, const math::Vector3& value)
+    {
+        forceX[body] = value.x;
+        forceY[body] = value.y;
+        forceZ[body] = value.z;
+    }
+
+
+    /////////////////////
+    // Body management //
+    /////////////////////
+
+    void BodyStore::moveBody (const unsigned int from, const unsigned int to)
+    {
+        positionX[to]   = positionX[from];
+        positionY[to]   = positionY[from];
+        positionZ[to]   = positionZ[from];
+        previousX[to]   = previousX[from];
+        previousY[to]   = previousY[from];
+        previousZ[to]   = previousZ[from];
+        velocityX[to]   = velocityX[from];
+        velocityY[to]   = velocityY[from];
+        velocityZ[to]   = velocityZ[from];
+        forceX[to]      = forceX[from];
+        forceY[to]      = forceY[from];
+        forceZ[to]      = forceZ[from];
+        inverseMass[to] = inverseMass[from];
+        drag[to]        = drag[from];
+        restitution[to] = restitution[from];
+        restTime[to]    = restTime[from];
+        sleepGroup[to]  = sleepGroup[from];
+        layers[to]      = layers[from];
+        flags[to]       = flags[from];
+        transforms[to]  = transforms[from];
+        owners[to]      = owners[from];
+
+        // Let the owner know where its body has gone.
+        owners[to]->m_body = to;
+    }
+
+
+    void BodyStore::resize (const unsigned int count)
+    {
+        positionX.resize (count);
+        positionY.resize (count);
+        positionZ.resize (count);
+        previousX.resize (count);
+        previousY.resize (count);
+        previousZ.resize (count);
+        velocityX.resize (count);
+        velocityY.resize (count);
+        velocityZ.resize (count);
+        forceX.resize (count);
+        forceY.resize (count);
+        forceZ.resize (count);
+        inverseMass.resize (count);
+        drag.resize (count);
+        restitution.resize (count);
+        restTime.resize (count);
+        sleepGroup.resize (count);
+        layers.resize (count);
+        flags.resize (count);
+        transforms.resize (count);
+        owners.resize (count);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#ifndef SPC_BODY_STORE_ASP_HPP
+#define SPC_BODY_STORE_ASP_HPP
+
+
+// STL headers.
+#include <cstdint>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+
+
+namespace spc
+{
+    // Forward declarations.
+    class PhysicsObject;
+
+
+    /// <summary>
+    /// Packed structure-of-arrays storage for the simulation state of every body in a PhysicsSystem. Each property
+    /// lives in its own contiguous array so that the integration loop streams through memory rather than chasing a
+    /// pointer per body. PhysicsObject instances are handles which index into the store.
+    /// </summary>
+    class BodyStore final
+    {
+        public:
+
+            /// <summary>
+            /// Bit flags describing the state of each body.
+            /// </summary>
+            enum Flag : std::uint8_t
+            {
+                Alive       = 1 << 0,   //!< The owning PhysicsObject still exists.
+                Static      = 1 << 1,   //!< The body doesn't move in response to forces or collisions.
+                Attached    = 1 << 2,   //!< The owning PhysicsObject was attached to an Actor and enabled at the start of the tick.
+                Sleeping    = 1 << 3,   //!< The body has come to rest and isn't simulated until something wakes it.
+                Continuous  = 1 << 4,   //!< The motion of the body is swept each step so it can't pass through objects.
+                Disabled    = 1 << 5    //!< The body is treated as if it weren't attached, so it's left out of the simulation.
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            BodyStore()                                     = default;
+
+            BodyStore (BodyStore&& move);
+            BodyStore& operator= (BodyStore&& move);
+
+            BodyStore (const BodyStore& copy)               = default;
+            BodyStore& operator= (const BodyStore& copy)    = default;
+            ~BodyStore()                                    = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets how many bodies are in the store, including dead bodies awaiting compaction. </summary>
+            /// <returns> The number of bodies. </returns>
+            unsigned int size() const   { return static_cast<unsigned int> (owners.size()); }
+
+            /// <summary> Reserves memory for the given number of bodies. </summary>
+            /// <param name="count"> How many bodies to reserve space for. </param>
+            void reserve (const unsigned int count);
+
+            /// <summary> Adds a new body with default properties to the end of the store. </summary>
+            /// <param name="owner"> The object which owns the body. </param>
+            /// <returns> The index of the new body. </returns>
+            unsigned int add (PhysicsObject* const owner);
+
+            /// <summary> Marks a body as dead, it will be removed upon the next compaction. </summary>
+            /// <param name="body"> The index of the body. </param>
+            void kill (const unsigned int body);
+
+            /// <summary> Removes every dead body whilst preserving the order of the living, owners are given their new indices. </summary>
+            void compact();
+
+            /// <summary> Checks whether a body has the given flag set. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="flag"> The flag to check. </param>
+            /// <returns> Whether the flag is set. </returns>
+            bool hasFlag (const unsigned int body, const Flag flag) const   { return (flags[body] & flag) != 0; }
+
+            /// <summary> Sets or clears a flag on a body. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="flag"> The flag to change. </param>
+            /// <param name="value"> Whether the flag should be set. </param>
+            void setFlag (const unsigned int body, const Flag flag, const bool value);
+
+            /// <summary> Gets the position of a body as a vector. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> The position of the body. </returns>
+            math::Vector3 position (const unsigned int body) const  { return { positionX[body], positionY[body], positionZ[body] }; }
+
+            /// <summary> Gets the position of a body before the most recent simulation step. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> The previous position of the body. </returns>
+            math::Vector3 previousPosition (const unsigned int body) const  { return { previousX[body], previousY[body], previousZ[body] }; }
+
+            /// <summary> Gets the velocity of a body as a vector. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> The velocity of the body. </returns>
+            math::Vector3 velocity (const unsigned int body) const  { return { velocityX[body], velocityY[body], velocityZ[body] }; }
+
+            /// <summary> Gets the force applied to a body as a vector. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> The force of the body. </returns>
+            math::Vector3 force (const unsigned int body) const     { return { forceX[body], forceY[body], forceZ[body] }; }
+
+            /// <summary> Sets the position of a body. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="value"> The new position. </param>
+            void setPosition (const unsigned int body, const math::Vector3& value);
+
+            /// <summary> Sets the velocity of a body. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="value"> The new velocity. </param>
+            void setVelocity (const unsigned int body, const math::Vector3& value);
+
+            /// <summary> Sets the force applied to a body. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="value"> The new force. </param>
+            void setForce (const unsigned int body, const math::Vector3& value);
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            std::vector<float>              positionX   { };    //!< The world position of each body on the X axis.
+            std::vector<float>              positionY   { };    //!< The world position of each body on the Y axis.
+            std::vector<float>              positionZ   { };    //!< The world position of each body on the Z axis.
+            std::vector<float>              previousX   { };    //!< The position of each body before the last step on the X axis.
+            std::vector<float>              previousY   { };    //!< The position of each body before the last step on the Y axis.
+            std::vector<float>              previousZ   { };    //!< The position of each body before the last step on the Z axis.
+            std::vector<float>              velocityX   { };    //!< The velocity of each body on the X axis.
+            std::vector<float>              velocityY   { };    //!< The velocity of each body on the Y axis.
+            std::vector<float>              velocityZ   { };    //!< The velocity of each body on the Z axis.
+            std::vector<float>              forceX      { };    //!< The force to apply on the next update on the X axis.
+            std::vector<float>              forceY      { };    //!< The force to apply on the next update on the Y axis.
+            std::vector<float>              forceZ      { };    //!< The force to apply on the next update on the Z axis.
+            std::vector<float>              inverseMass { };    //!< The reciprocal of the mass of each body.
+            std::vector<float>              drag        { };    //!< The drag co-efficient of each body.
+            std::vector<float>              restitution { };    //!< The amount of velocity each body maintains upon collision.
+            std::vector<float>              restTime    { };    //!< How long each body has been moving slowly enough to sleep.
+            std::vector<unsigned int>       sleepGroup  { };    //!< The ID shared by every body which fell asleep in the same island.
+            std::vector<std::uint32_t>      layers      { };    //!< Which force generators affect each body, as a bit mask.
+            std::vector<std::uint8_t>       flags       { };    //!< The Flag values of each body.
+            std::vector<math::Matrix4x4>    transforms  { };    //!< The Actor transformation of each body at the start of the tick.
+            std::vector<PhysicsObject*>     owners      { };    //!< The object which owns each body, null if dead.
+
+        private:
+
+            /// <summary> Moves every property of a body to a new index. </summary>
+            /// <param name="from"> The current index of the body. </param>
+            /// <param name="to"> The desired index. </param>
+            void moveBody (const unsigned int from, const unsigned int to);
+
+            /// <summary> Resizes every array to the given size. </summary>
+            /// <param name="count"> The desired size. </param>
+            void resize (const unsigned int count);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            unsigned int    m_dead  { 0 };  //!< How many bodies are awaiting removal.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+#ifndef SPC_BROADPHASE_ASP_HPP
+#define SPC_BROADPHASE_ASP_HPP
+
+
+// Personal headers.
+#include <Physics/AABB.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// A finite object as seen by the broadphase. The index refers to the position of the object in the collection
+    /// the PhysicsSystem gathered for the current tick.
+    /// </summary>
+    struct BroadphaseProxy final
+    {
+        AABB            bounds      { };        //!< The world space bounds of the object.
+        unsigned int    index       { 0 };      //!< The index of the object this proxy represents.
+        unsigned int    id          { 0 };      //!< The unique ID of the object, allows broadphases to track objects across ticks.
+        bool            isStatic    { false };  //!< Static and sleeping objects are never paired with each other.
+    };
+
+
+    /// <summary>
+    /// A pair of objects which the broadphase believes could be colliding, the narrowphase will decide for certain.
+    /// </summary>
+    struct BroadphasePair final
+    {
+        unsigned int    lhs { 0 };  //!< The index of the first object.
+        unsigned int    rhs { 0 };  //!< The index of the second object.
+    };
+}
+
+#endif
\ No newline at end of file
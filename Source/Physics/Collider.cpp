@@ -0,0 +1,126 @@
+#include "Collider.hpp"
+
+
+// STL headers.
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+
+// Personal headers.
+#include <Physics/PhysicsBox.hpp>
+#include <Physics/PhysicsPlane.hpp>
+#include <Physics/PhysicsSphere.hpp>
+
+
+namespace spc
+{
+    // Axes this close to the normal of a plane are treated as parallel to it.
+    static const auto planeAlignment = 0.9999f;
+
+
+    Collider Collider::fromObject (const PhysicsObject& object)
+    {
+        Collider collider { };
+        collider.type     = object.getType();
+        collider.attached = object.isAttached();
+
+        switch (collider.type)
+        {
+            case PhysicsObject::Type::Sphere:
+            {
+                collider.centre = object.position();
+                collider.radius = static_cast<const PhysicsSphere&> (object).radius;
+                break;
+            }
+
+            case PhysicsObject::Type::Box:
+            {
+                const auto frame     = static_cast<const PhysicsBox&> (object).frame();
+                collider.centre      = frame.centre;
+                collider.axes        = frame.axes;
+                collider.halfExtents = frame.halfExtents;
+                break;
+            }
+
+            case PhysicsObject::Type::Plane:
+            {
+                collider.centre = object.position();
+                collider.normal = math::unit (static_cast<const PhysicsPlane&> (object).normal());
+                collider.offset = math::dot (collider.centre, collider.normal);
+                break;
+            }
+
+            default:
+                assert (false);
+                break;
+        }
+
+        return collider;
+    }
+
+
+    AABB Collider::bounds() const
+    {
+        switch (type)
+        {
+            case PhysicsObject::Type::Sphere:
+                return AABB::fromCentre (centre, { radius, radius, radius });
+
+            case PhysicsObject::Type::Box:
+            {
+                // Each axis contributes its absolute length on each world axis.
+                auto extents = math::Vector3 (0.f, 0.f, 0.f);
+
+                for (auto i = 0U; i < 3; ++i)
+                {
+                    extents += math::Vector3 (std::abs (axes[i].x), std::abs (axes[i].y), std::abs (axes[i].z)) * halfExtents[i];
+                }
+
+                return AABB::fromCentre (centre, extents);
+            }
+
+            default:
+                return AABB::infinite();
+        }
+    }
+
+
+    void Collider::project (const math::Vector3& axis, float& min, float& max) const
+    {
+        const auto projected = math::dot (centre, axis);
+
+        switch (type)
+        {
+            case PhysicsObject::Type::Sphere:
+            {
+                min = projected - radius;
+                max = projected + radius;
+                break;
+            }
+
+            case PhysicsObject::Type::Box:
+            {
+                auto extent = 0.f;
+
+                for (auto i = 0U; i < 3; ++i)
+                {
+                    extent += std::abs (math::dot (axes[i], axis)) * halfExtents[i];
+                }
+
+                min = projected - extent;
+                max = projected + extent;
+                break;
+            }
+
+            default:
+            {
+                const auto alignment = math::dot (normal, axis);
+
+                min = alignment < -planeAlignment ? projected : -std::numeric_limits<float>::max();
+                max = alignment > planeAlignment ? projected : std::numeric_limits<float>::max();
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef SPC_COLLIDER_ASP_HPP
+#define SPC_COLLIDER_ASP_HPP
+
+
+// STL headers.
+#include <array>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/AABB.hpp>
+#include <Physics/PhysicsObject.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// The world space shape of a PhysicsObject, built by the PhysicsSystem once per step before collision detection.
+    /// The broadphase and narrowphase read only from these so each transformation is fetched and each plane normal is
+    /// normalised once per step, rather than once per pair the object is part of. Only the fields of the type are valid.
+    /// </summary>
+    struct Collider final
+    {
+        PhysicsObject::Type             type        { PhysicsObject::Type::Sphere };    //!< Which shape the collider is.
+        bool                            attached    { false };                          //!< Whether the object was attached to an Actor, unattached colliders never collide.
+        math::Vector3                   centre      { };                                //!< The world position of the object.
+        float                           radius      { 0.f };                            //!< The radius of a sphere.
+        std::array<math::Vector3, 3>    axes        { };                                //!< The unit directions of the U, V and W axes of a box.
+        std::array<float, 3>            halfExtents { };                                //!< Half the length of a box along each axis.
+        math::Vector3                   normal      { };                                //!< The unit normal of a plane.
+        float                           offset      { 0.f };                            //!< The distance of a plane from the origin along its normal.
+
+
+        /// <summary> Builds the world space shape of an object from its current state. </summary>
+        /// <param name="object"> The object to build the collider of. </param>
+        /// <returns> The collider of the object. </returns>
+        static Collider fromObject (const PhysicsObject& object);
+
+        /// <summary> Calculates the world space bounds of the collider for use in the broadphase. </summary>
+        /// <returns> An axis-aligned box containing the entire collider, infinite for planes. </returns>
+        AABB bounds() const;
+
+        /// <summary>
+        /// Projects the collider onto an axis, if the projections of two colliders don't overlap they can't be touching.
+        /// Everything below a plane is solid, so its projection is only finite on one side when the axis is parallel
+        /// to the normal and is infinite otherwise.
+        /// </summary>
+        /// <param name="axis"> The unit axis to project onto. </param>
+        /// <param name="min"> Set to the lowest point of the collider along the axis. </param>
+        /// <param name="max"> Set to the highest point of the collider along the axis. </param>
+        void project (const math::Vector3& axis, float& min, float& max) const;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -2,214 +2,699 @@
 
 
 // STL headers.
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 
 // Personal headers.
-#include <Physics/PhysicsBox.hpp>
-#include <Physics/PhysicsPlane.hpp>
-#include <Physics/PhysicsSphere.hpp>
 #include <Utility/Misc.hpp>
 #include <Utility/Tyga.hpp>
 
 
 namespace spc
 {
-    template <typename T, typename U, typename V>
-    void CollisionDetection::passToFunction (PhysicsObject& lhs, PhysicsObject& rhs, const V& function)
+    // Edge axes shorter than this come from nearly parallel edges, which the face axes already cover.
+    static const auto minEdgeAxisSqr = 1e-6f;
+
+    // An axis must be this much better than a face axis of the first box to be used instead, which stops the contact
+    // flicking between features when depths are almost equal.
+    static const auto relativeTolerance = 0.98f;
+    static const auto absoluteTolerance = 0.001f;
+
+
+    // The number of rows and columns in the dispatch table.
+    static const auto typeCount = static_cast<int> (PhysicsObject::Type::Count);
+
+
+    /// <summary> A list of table indices, expanded to generate every entry of the table at once. </summary>
+    template <int... Indices> 
+    struct IndexList final { };
+
+    /// <summary> Generates the list of indices from 0 to Count - 1. </summary>
+    template <int Count, int... Indices> 
+    struct MakeIndexList final
+    {
+        using type = typename MakeIndexList<Count - 1, Count - 1, Indices...>::type;
+    };
+
+    template <int... Indices> 
+    struct MakeIndexList<0, Indices...> final
+    {
+        using type = IndexList<Indices...>;
+    };
+
+
+    /// <summary> 
+    /// Chooses the entry of the dispatch table for a combination of types. A handler registered in the same order is used
+    /// directly, one registered in the opposite order is given the colliders swapped and has its normal flipped.
+    /// </summary>
+    template <PhysicsObject::Type Lhs, PhysicsObject::Type Rhs, 
+              bool Direct = CollisionHandler<Lhs, Rhs>::defined, bool Swapped = CollisionHandler<Rhs, Lhs>::defined>
+    struct CollisionDispatch final
+    {
+        static const bool canonical = true;
+
+        static bool collide (const Collider&, const Collider&, ContactManifold&)
+        {
+            return false;
+        }
+    };
+
+    template <PhysicsObject::Type Lhs, PhysicsObject::Type Rhs, bool Swapped>
+    struct CollisionDispatch<Lhs, Rhs, true, Swapped> final
+    {
+        static const bool canonical = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionHandler<Lhs, Rhs>::collide (lhs, rhs, manifold);
+        }
+    };
+
+    template <PhysicsObject::Type Lhs, PhysicsObject::Type Rhs>
+    struct CollisionDispatch<Lhs, Rhs, false, true> final
     {
-        function (static_cast<T&> (lhs), static_cast<U&> (rhs));
+        static const bool canonical = false;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            if (CollisionHandler<Rhs, Lhs>::collide (rhs, lhs, manifold))
+            {
+                manifold.flip();
+                return true;
+            }
+
+            // The separating axis must point from lhs to rhs too.
+            manifold.normal = -manifold.normal;
+            return false;
+        }
+    };
+
+
+    /// <summary> 
+    /// The dispatch table, indexed by the type of the first collider multiplied by the number of types plus the type of
+    /// the second. Every entry is a constant so the table is filled in at compile time.
+    /// </summary>
+    template <typename List> 
+    struct CollisionTable;
+
+    template <int... Indices> 
+    struct CollisionTable<IndexList<Indices...>> final
+    {
+        static const CollisionDetection::Handler   handlers[sizeof... (Indices)];   //!< The function to call for each combination.
+        static const bool                          canonical[sizeof... (Indices)];  //!< Whether each combination is tested without swapping.
+    };
+
+    template <int... Indices> 
+    const CollisionDetection::Handler CollisionTable<IndexList<Indices...>>::handlers[sizeof... (Indices)] = 
+    { 
+        &CollisionDispatch<static_cast<PhysicsObject::Type> (Indices / typeCount), static_cast<PhysicsObject::Type> (Indices % typeCount)>::collide... 
+    };
+
+    template <int... Indices> 
+    const bool CollisionTable<IndexList<Indices...>>::canonical[sizeof... (Indices)] = 
+    { 
+        CollisionDispatch<static_cast<PhysicsObject::Type> (Indices / typeCount), static_cast<PhysicsObject::Type> (Indices % typeCount)>::canonical... 
+    };
+
+    using DispatchTable = CollisionTable<MakeIndexList<typeCount * typeCount>::type>;
+
+
+    CollisionDetection::Handler CollisionDetection::getHandler (const PhysicsObject::Type lhs, const PhysicsObject::Type rhs)
+    {
+        // Pre-condition: Both types are valid.
+        assert (lhs < PhysicsObject::Type::Count && rhs < PhysicsObject::Type::Count);
+
+        return DispatchTable::handlers[static_cast<int> (lhs) * typeCount + static_cast<int> (rhs)];
     }
 
 
-    void CollisionDetection::detectCollision (PhysicsObject& lhs, PhysicsObject& rhs)
+    bool CollisionDetection::isCanonical (const PhysicsObject::Type lhs, const PhysicsObject::Type rhs)
+    {
+        // Pre-condition: Both types are valid.
+        assert (lhs < PhysicsObject::Type::Count && rhs < PhysicsObject::Type::Count);
+
+        return DispatchTable::canonical[static_cast<int> (lhs) * typeCount + static_cast<int> (rhs)];
+    }
+
+
+    bool CollisionDetection::detectCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
     {
         // Pre-condition: The actor is valid.
-        if (lhs.Actor() && rhs.Actor())
+        if (lhs.attached && rhs.attached)
         {
-            // We need to check which type each object is castable to.
-            const auto lhsType = lhs.getType();
-            const auto rhsType = rhs.getType();
+            // Start from an empty manifold.
+            manifold.contactCount = 0;
+            manifold.normal       = math::Vector3 (0.f, 0.f, 0.f);
 
-            switch (lhsType)
-            {
-                case PhysicsObject::Type::Sphere:
-                    switch (rhsType)
-                    {
-                        case PhysicsObject::Type::Sphere:
-                            passToFunction<PhysicsSphere, PhysicsSphere> (lhs, rhs, &sphereSphereCollision);
-                            break;
-
-                        case PhysicsObject::Type::Box:
-                            passToFunction<PhysicsSphere, PhysicsBox> (lhs, rhs, &sphereBoxCollision);
-                            break;
-                    
-                        case PhysicsObject::Type::Plane:
-                            passToFunction<PhysicsSphere, PhysicsPlane> (lhs, rhs, &spherePlaneCollision);
-                            break;
-                    }
-                    break;
+            return getHandler (lhs.type, rhs.type) (lhs, rhs, manifold);
+        }
 
-                case PhysicsObject::Type::Box:
-                    switch (rhsType)
-                    {
-                        case PhysicsObject::Type::Box:
-                            passToFunction<PhysicsBox, PhysicsBox> (lhs, rhs, &boxBoxCollision);
-                            break;
-
-                        case PhysicsObject::Type::Plane:
-                            passToFunction<PhysicsBox, PhysicsPlane> (lhs, rhs, &boxPlaneCollision);
-                            break;
-                    
-                        case PhysicsObject::Type::Sphere: // We've done this so swap the parameters.
-                            passToFunction<PhysicsSphere, PhysicsBox> (rhs, lhs, &sphereBoxCollision);
-                            break;
-                    }
-                    break;
+        return false;
+    }
 
-                case PhysicsObject::Type::Plane:
-                    switch (rhsType)
-                    {
-                        case PhysicsObject::Type::Plane:
-                            passToFunction<PhysicsPlane, PhysicsPlane> (lhs, rhs, &planePlaneCollision);
-                            break;
-
-                        case PhysicsObject::Type::Sphere: // We've done this so swap the parameters.
-                            passToFunction<PhysicsSphere, PhysicsPlane> (rhs, lhs, &spherePlaneCollision);
-                            break;
-                    
-                        case PhysicsObject::Type::Box: // We've done this so swap the parameters.
-                            passToFunction<PhysicsBox, PhysicsPlane> (rhs, lhs, &boxPlaneCollision);
-                            break;
-                    }
-                    break;
 
-                default:
-                    assert (false);
-                    break;
-            }
+    bool CollisionDetection::isSeparated (const Collider& lhs, const Collider& rhs, const math::Vector3& axis)
+    {
+        auto lhsMin = 0.f, lhsMax = 0.f,
+             rhsMin = 0.f, rhsMax = 0.f;
+
+        lhs.project (axis, lhsMin, lhsMax);
+        rhs.project (axis, rhsMin, rhsMax);
+
+        return lhsMax < rhsMin || rhsMax < lhsMin;
+    }
+
+
+    bool CollisionDetection::sweepSpherePlane (const Collider& sphere, const math::Vector3& motion, const Collider& plane, float& time)
+    {
+        // The distance between the surfaces changes linearly, spheres starting inside the plane are left to the narrowphase.
+        const auto start = math::dot (sphere.centre, plane.normal) - plane.offset - sphere.radius;
+        const auto end   = start + math::dot (motion, plane.normal);
+
+        if (start < 0.f || end >= 0.f)
+        {
+            return false;
         }
+
+        time = start / (start - end);
+        return true;
     }
 
 
-    void CollisionDetection::sphereSphereCollision (PhysicsSphere& lhs, PhysicsSphere& rhs)
+    bool CollisionDetection::sweepSphereSphere (const Collider& lhs, const math::Vector3& lhsMotion, 
+                                                const Collider& rhs, const math::Vector3& rhsMotion, float& time)
     {
-        // Obtain a reference to the actors.
-        auto& lhsActor = *lhs.Actor();
-        auto& rhsActor = *rhs.Actor();
+        // Solve |offset + motion * t| = radiusSum for the smallest t, treating rhs as stationary.
+        const auto offset    = lhs.centre - rhs.centre;
+        const auto motion    = lhsMotion - rhsMotion;
+        const auto radiusSum = lhs.radius + rhs.radius;
+
+        const auto a = math::dot (motion, motion);
+        const auto b = math::dot (offset, motion);
+        const auto c = math::dot (offset, offset) - util::squared (radiusSum);
+
+        // Spheres which already overlap are left to the narrowphase, as are those which aren't approaching.
+        if (c < 0.f || b >= 0.f || a <= 0.f)
+        {
+            return false;
+        }
+
+        const auto discriminant = b * b - a * c;
+
+        if (discriminant < 0.f)
+        {
+            return false;
+        }
+
+        time = (-b - std::sqrt (discriminant)) / a;
+        return time <= 1.f;
+    }
+
 
+    bool CollisionDetection::sphereSphereCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+    {
         // We need the position of each object.
-        const auto lhsPos = util::position (lhsActor.Transformation()),
-                   rhsPos = util::position (rhsActor.Transformation());
+        const auto& lhsPos = lhs.centre;
+        const auto& rhsPos = rhs.centre;
 
         // The square length will be lower than the sum of the squared radius of each sphere if there is a collision.
-        const auto distance  = lhsPos - rhsPos;
-        const auto lengthSqr = util::sqrLength (lhsPos - rhsPos),
+        const auto distance  = rhsPos - lhsPos;
+        const auto lengthSqr = util::sqrLength (distance),
                    radiusSum = lhs.radius + rhs.radius;
 
+        // Spheres sharing a centre have no sensible normal so just push them apart vertically.
+        const auto length = std::sqrt (lengthSqr);
+        const auto normal = length > 0.f ? distance / length : math::Vector3 (0.f, 1.f, 0.f);
+
+        // The normal separates the spheres if they don't collide, so it's kept either way.
+        manifold.normal = normal;
+
         if (lengthSqr <= util::squared (radiusSum))
         {
-            // We've collided! Move the objects out of collision with each other.
-            const auto length       = std::sqrt (lengthSqr);
-            const auto normal       = distance / length;
-            const auto intersection = length - radiusSum;
+            // We've collided!
+            const auto depth = radiusSum - length;
 
-            collisionResponse (lhs, rhs, normal, intersection);
+            manifold.addContact (lhsPos + normal * (lhs.radius - depth * 0.5f), depth);
+            return true;
         }
+
+        return false;
     }
 
 
-    void CollisionDetection::sphereBoxCollision (PhysicsSphere& sphere, PhysicsBox& box)
+    bool CollisionDetection::sphereBoxCollision (const Collider& sphere, const Collider& box, ContactManifold& manifold)
     {
-    
+        // Work in the space of the box so the closest point is found by clamping.
+        const auto& centre = sphere.centre;
+        const auto& frame  = box;
+        const auto offset  = centre - frame.centre;
+
+        auto closest = frame.centre;
+        auto inside  = true;
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            const auto distance = math::dot (offset, frame.axes[i]);
+            const auto clamped  = std::min (std::max (distance, -frame.halfExtents[i]), frame.halfExtents[i]);
+
+            closest += frame.axes[i] * clamped;
+            inside  &= clamped == distance;
+        }
+
+        if (!inside)
+        {
+            // The direction towards the closest point separates the objects if they don't collide.
+            const auto towards   = closest - centre;
+            const auto lengthSqr = util::sqrLength (towards);
+            const auto length    = std::sqrt (lengthSqr);
+
+            // A centre which rounds onto the surface has no direction to the closest point, so head for the middle.
+            manifold.normal = length > 0.f ? towards / length : math::unit (frame.centre - centre);
+
+            if (lengthSqr <= util::squared (sphere.radius))
+            {
+                const auto depth = sphere.radius - length;
+
+                manifold.addContact (centre + manifold.normal * (sphere.radius - depth * 0.5f), depth);
+                return true;
+            }
+
+            return false;
+        }
+
+        // The centre is inside the box so push the sphere out through the nearest face.
+        auto face     = 0U;
+        auto faceGap  = std::numeric_limits<float>::max();
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            const auto gap = frame.halfExtents[i] - std::abs (math::dot (offset, frame.axes[i]));
+
+            if (gap < faceGap)
+            {
+                face    = i;
+                faceGap = gap;
+            }
+        }
+
+        const auto side  = math::dot (offset, frame.axes[face]) < 0.f ? 1.f : -1.f;
+        const auto depth = sphere.radius + faceGap;
+
+        manifold.normal = frame.axes[face] * side;
+        manifold.addContact (centre + manifold.normal * (sphere.radius - depth * 0.5f), depth);
+        return true;
     }
 
 
-    void CollisionDetection::spherePlaneCollision (PhysicsSphere& sphere, PhysicsPlane& plane)
+    bool CollisionDetection::spherePlaneCollision (const Collider& sphere, const Collider& plane, ContactManifold& manifold)
     {
-        // Obtain a reference to the actors.
-        auto& sphereActor = *sphere.Actor();
-        auto& planeActor  = *plane.Actor();
-
-        // We need the position of each object.
-        const auto spherePos = util::position (sphereActor.Transformation()),
-                   planePos  = util::position (planeActor.Transformation()),
-                   normal    = tyga::unit (plane.normal());
+        // We need the position of the sphere and the normal of the plane.
+        const auto& spherePos = sphere.centre;
+        const auto& normal    = plane.normal;
 
         // The formula for collision is c.n - q.n < radius.
-        const auto sphereDot = tyga::dot (spherePos, normal),
-                   planeDot  = tyga::dot (planePos, normal),
-                   distance  = sphereDot - planeDot;
+        const auto sphereDot = math::dot (spherePos, normal),
+                   distance  = sphereDot - plane.offset;
+
+        // The normal has to point from the sphere towards the plane, it separates them if they don't collide.
+        manifold.normal = -normal;
 
         if (distance < sphere.radius)
         {
-            collisionResponse (plane, sphere, normal, sphere.radius - distance);
+            const auto depth = sphere.radius - distance;
+
+            manifold.addContact (spherePos - normal * (sphere.radius - depth * 0.5f), depth);
+            return true;
         }
+
+        return false;
     }
 
 
-    void CollisionDetection::boxBoxCollision (PhysicsBox& lhs, PhysicsBox& rhs)
+    bool CollisionDetection::boxBoxCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
     {
-    
+        const auto& a     = lhs;
+        const auto& b     = rhs;
+        const auto offset = b.centre - a.centre;
+
+        // The axis of least penetration, kind is 0 for a face of lhs, 1 for a face of rhs and 2 for a pair of edges.
+        auto bestDepth  = std::numeric_limits<float>::max();
+        auto bestNormal = math::Vector3 (0.f, 1.f, 0.f);
+        auto bestKind   = 0U;
+        auto bestLhs    = 0U;
+        auto bestRhs    = 0U;
+
+        // Returns false if the axis separates the boxes.
+        const auto testAxis = [&] (const math::Vector3& axis, const unsigned int kind, const unsigned int lhsAxis, const unsigned int rhsAxis)
+        {
+            auto lhsRadius = 0.f,
+                 rhsRadius = 0.f;
+
+            for (auto i = 0U; i < 3; ++i)
+            {
+                lhsRadius += a.halfExtents[i] * std::abs (math::dot (a.axes[i], axis));
+                rhsRadius += b.halfExtents[i] * std::abs (math::dot (b.axes[i], axis));
+            }
+
+            const auto distance = math::dot (offset, axis);
+            const auto depth    = lhsRadius + rhsRadius - std::abs (distance);
+
+            if (depth < 0.f)
+            {
+                manifold.normal = axis;
+                return false;
+            }
+
+            const auto better = kind == 0 ? depth < bestDepth : depth < bestDepth * relativeTolerance - absoluteTolerance;
+
+            if (better)
+            {
+                bestDepth  = depth;
+                bestNormal = distance < 0.f ? -axis : axis;
+                bestKind   = kind;
+                bestLhs    = lhsAxis;
+                bestRhs    = rhsAxis;
+            }
+
+            return true;
+        };
+
+        // Test the face axes first so they're preferred over the edges.
+        for (auto i = 0U; i < 3; ++i)
+        {
+            if (!testAxis (a.axes[i], 0, i, 0))
+            {
+                return false;
+            }
+        }
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            if (!testAxis (b.axes[i], 1, 0, i))
+            {
+                return false;
+            }
+        }
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            for (auto j = 0U; j < 3; ++j)
+            {
+                const auto axis      = math::cross (a.axes[i], b.axes[j]);
+                const auto lengthSqr = util::sqrLength (axis);
+
+                if (lengthSqr > minEdgeAxisSqr && !testAxis (axis / std::sqrt (lengthSqr), 2, i, j))
+                {
+                    return false;
+                }
+            }
+        }
+
+        // We've collided! Contacts are found on the feature of the least penetrating axis.
+        manifold.normal = bestNormal;
+
+        switch (bestKind)
+        {
+            case 0:
+                boxFaceContacts (a, bestLhs, bestNormal, b, manifold);
+                break;
+
+            case 1:
+                boxFaceContacts (b, bestRhs, -bestNormal, a, manifold);
+                break;
+
+            default:
+                boxEdgeContact (a, bestLhs, b, bestRhs, bestNormal, bestDepth, manifold);
+                break;
+        }
+
+        return true;
     }
 
 
-    void CollisionDetection::boxPlaneCollision (PhysicsBox& box, PhysicsPlane& plane)
+    bool CollisionDetection::boxPlaneCollision (const Collider& box, const Collider& plane, ContactManifold& manifold)
     {
-    
+        const auto& frame   = box;
+        const auto& normal  = plane.normal;
+        const auto planeDot = plane.offset;
+
+        // The normal has to point from the box towards the plane, it separates them if they don't collide.
+        manifold.normal = -normal;
+
+        // The box can only reach the plane if the distance of its centre is less than its radius along the normal.
+        auto radius = 0.f;
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            radius += frame.halfExtents[i] * std::abs (math::dot (frame.axes[i], normal));
+        }
+
+        if (math::dot (frame.centre, normal) - planeDot >= radius)
+        {
+            return false;
+        }
+
+        // Find every corner below the plane.
+        std::array<math::Vector3, 8> corners { };
+        std::array<float, 8> depths { };
+        auto count = 0U;
+
+        for (auto corner = 0U; corner < 8; ++corner)
+        {
+            auto point = frame.centre;
+
+            for (auto i = 0U; i < 3; ++i)
+            {
+                point += frame.axes[i] * ((corner & (1U << i)) ? frame.halfExtents[i] : -frame.halfExtents[i]);
+            }
+
+            const auto depth = planeDot - math::dot (point, normal);
+
+            if (depth > 0.f)
+            {
+                corners[count] = point;
+                depths[count]  = depth;
+                ++count;
+            }
+        }
+
+        // A box sunk past its middle has more corners below the plane than a manifold can hold, keep the deepest.
+        while (count > ContactManifold::maxContacts)
+        {
+            const auto shallowest = std::min_element (depths.begin(), depths.begin() + count) - depths.begin();
+
+            corners[shallowest] = corners[count - 1];
+            depths[shallowest]  = depths[count - 1];
+            --count;
+        }
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            manifold.addContact (corners[i] + normal * (depths[i] * 0.5f), depths[i]);
+        }
+
+        return count > 0;
     }
 
 
-    void CollisionDetection::planePlaneCollision (PhysicsPlane& lhs, PhysicsPlane& rhs)
+    bool CollisionDetection::planePlaneCollision (const Collider&, const Collider&, ContactManifold&)
     {
-    
+        // Planes are infinite and never move, so there's nothing useful to resolve between two of them.
+        return false;
     }
 
 
-    void CollisionDetection::collisionResponse (PhysicsObject& lhs, PhysicsObject& rhs, const tyga::Vector3& normal, const float intersection)
-    {    
-        // Obtain references to the actual actors.
-        auto& lhsActor = *lhs.Actor();
-        auto& rhsActor = *rhs.Actor();
+    void CollisionDetection::boxFaceContacts (const Collider& reference, const unsigned int axis, const math::Vector3& normal, 
+                                              const Collider& incident, ContactManifold& manifold)
+    {
+        // The incident face is the one facing most against the reference face.
+        auto incidentAxis = 0U;
+        auto alignment    = -1.f;
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            const auto current = std::abs (math::dot (incident.axes[i], normal));
+
+            if (current > alignment)
+            {
+                incidentAxis = i;
+                alignment    = current;
+            }
+        }
+
+        const auto facing = math::dot (incident.axes[incidentAxis], normal) > 0.f ? -1.f : 1.f;
+        const auto centre = incident.centre + incident.axes[incidentAxis] * (facing * incident.halfExtents[incidentAxis]);
+        const auto u      = incident.axes[(incidentAxis + 1) % 3] * incident.halfExtents[(incidentAxis + 1) % 3];
+        const auto v      = incident.axes[(incidentAxis + 2) % 3] * incident.halfExtents[(incidentAxis + 2) % 3];
+
+        // Clipping against each side can add a corner to the polygon, so it can end up with twice as many.
+        std::array<math::Vector3, 8> polygon { centre + u + v, centre - u + v, centre - u - v, centre + u - v };
+        std::array<math::Vector3, 8> clipped { };
+        auto count = 4U;
 
-        // We need to determine how much to reflect objects by.
-        const auto lhsReflect = (lhs.velocity - 2 * -normal * (tyga::dot (lhs.velocity, -normal))) * lhs.restitution,
-                   rhsReflect = (rhs.velocity - 2 * normal * (tyga::dot (rhs.velocity, normal))) * rhs.restitution;
-        
-        // Determine how much to correct each object by.
-        const auto correction = normal * (intersection * 0.5001f);
-        
-        // Move the actors out of each others path.
-        if (rhs.isStatic)
+        for (const auto side : { (axis + 1) % 3, (axis + 2) % 3 })
         {
-            lhsActor.setTransformation (rhsActor.Transformation() * util::translate (correction * -2.f));
-            lhs.velocity = lhsReflect;
+            for (const auto sign : { 1.f, -1.f })
+            {
+                // Keep the parts of the polygon where dot (point, sideNormal) <= limit.
+                const auto sideNormal = reference.axes[side] * sign;
+                const auto limit      = math::dot (reference.centre, sideNormal) + reference.halfExtents[side];
+
+                auto clippedCount = 0U;
+
+                for (auto i = 0U; i < count; ++i)
+                {
+                    const auto& start   = polygon[i];
+                    const auto& end     = polygon[(i + 1) % count];
+                    const auto startGap = math::dot (start, sideNormal) - limit;
+                    const auto endGap   = math::dot (end, sideNormal) - limit;
+
+                    if (startGap <= 0.f)
+                    {
+                        clipped[clippedCount++] = start;
+                    }
+
+                    if ((startGap < 0.f && endGap > 0.f) || (startGap > 0.f && endGap < 0.f))
+                    {
+                        clipped[clippedCount++] = start + (end - start) * (startGap / (startGap - endGap));
+                    }
+                }
+
+                polygon = clipped;
+                count   = clippedCount;
+            }
+        }
+
+        // Every point below the reference face is a contact.
+        const auto faceDot = math::dot (reference.centre, normal) + reference.halfExtents[axis];
+
+        std::array<math::Vector3, 8> points { };
+        std::array<float, 8> depths { };
+        auto pointCount = 0U;
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            const auto depth = faceDot - math::dot (polygon[i], normal);
+
+            if (depth >= 0.f)
+            {
+                points[pointCount] = polygon[i] + normal * (depth * 0.5f);
+                depths[pointCount] = depth;
+                ++pointCount;
+            }
+        }
+
+        // Rounding can clip away everything when the boxes barely touch, so fall back to the centre of the incident face.
+        if (pointCount == 0)
+        {
+            const auto depth = std::max (faceDot - math::dot (centre, normal), 0.f);
+            manifold.addContact (centre + normal * (depth * 0.5f), depth);
+            return;
+        }
+
+        if (pointCount <= ContactManifold::maxContacts)
+        {
+            for (auto i = 0U; i < pointCount; ++i)
+            {
+                manifold.addContact (points[i], depths[i]);
+            }
+
+            return;
         }
 
-        else if (lhs.isStatic)
+        // Too many points, so keep the deepest, the furthest from it and the two which cover the most area either side.
+        const auto first = static_cast<unsigned int> (std::max_element (depths.begin(), depths.begin() + pointCount) - depths.begin());
+
+        auto second   = first;
+        auto furthest = -1.f;
+
+        for (auto i = 0U; i < pointCount; ++i)
         {
-            rhsActor.setTransformation (rhsActor.Transformation() * util::translate (correction * 2.f));
-            rhs.velocity = rhsReflect;
+            const auto distance = util::sqrLength (points[i] - points[first]);
+
+            if (distance > furthest)
+            {
+                second   = i;
+                furthest = distance;
+            }
         }
 
-        else
+        auto third     = first,
+             fourth    = first;
+        auto mostLeft  = 0.f,
+             mostRight = 0.f;
+
+        for (auto i = 0U; i < pointCount; ++i)
         {
-            lhsActor.setTransformation (lhsActor.Transformation() * util::translate (-correction));
-            rhsActor.setTransformation (rhsActor.Transformation() * util::translate (correction));
+            const auto area = math::dot (math::cross (points[second] - points[first], points[i] - points[first]), normal);
 
-            lhs.velocity = lhsReflect;
-            rhs.velocity = rhsReflect;
+            if (area > mostLeft)
+            {
+                third    = i;
+                mostLeft = area;
+            }
+
+            else if (area < mostRight)
+            {
+                fourth    = i;
+                mostRight = area;
+            }
         }
 
-        // Trigger the collision events.
-        if (lhs.onCollide)
+        const auto chosen = std::array<unsigned int, 4> { first, second, third, fourth };
+
+        for (auto i = 0U; i < chosen.size(); ++i)
         {
-            lhs.onCollide (rhs);
+            // Degenerate polygons can pick the same point more than once.
+            if (std::find (chosen.begin(), chosen.begin() + i, chosen[i]) == chosen.begin() + i)
+            {
+                manifold.addContact (points[chosen[i]], depths[chosen[i]]);
+            }
         }
+    }
 
-        if (rhs.onCollide)
+
+    void CollisionDetection::boxEdgeContact (const Collider& lhs, const unsigned int lhsAxis, const Collider& rhs, const unsigned int rhsAxis, 
+                                             const math::Vector3& normal, const float depth, ContactManifold& manifold)
+    {
+        // The touching edges are the ones furthest towards the other box.
+        auto lhsPoint = lhs.centre,
+             rhsPoint = rhs.centre;
+
+        for (auto i = 0U; i < 3; ++i)
         {
-            rhs.onCollide (lhs);
+            if (i != lhsAxis)
+            {
+                lhsPoint += lhs.axes[i] * (math::dot (lhs.axes[i], normal) > 0.f ? lhs.halfExtents[i] : -lhs.halfExtents[i]);
+            }
+
+            if (i != rhsAxis)
+            {
+                rhsPoint += rhs.axes[i] * (math::dot (rhs.axes[i], normal) > 0.f ? -rhs.halfExtents[i] : rhs.halfExtents[i]);
+            }
         }
+
+        // Find the closest points on the lines through both edges, then clamp them to the edges.
+        const auto& lhsDirection = lhs.axes[lhsAxis];
+        const auto& rhsDirection = rhs.axes[rhsAxis];
+        const auto between       = lhsPoint - rhsPoint;
+        const auto alignment     = math::dot (lhsDirection, rhsDirection);
+        const auto lhsDot        = math::dot (lhsDirection, between);
+        const auto rhsDot        = math::dot (rhsDirection, between);
+        const auto denominator   = 1.f - alignment * alignment;
+
+        const auto lhsLimit = lhs.halfExtents[lhsAxis];
+        const auto rhsLimit = rhs.halfExtents[rhsAxis];
+        const auto lhsAlong = denominator > 0.f ? std::min (std::max ((alignment * rhsDot - lhsDot) / denominator, -lhsLimit), lhsLimit) : 0.f;
+        const auto rhsAlong = std::min (std::max (alignment * lhsAlong + rhsDot, -rhsLimit), rhsLimit);
+
+        const auto lhsClosest = lhsPoint + lhsDirection * lhsAlong;
+        const auto rhsClosest = rhsPoint + rhsDirection * rhsAlong;
+
+        manifold.addContact ((lhsClosest + rhsClosest) * 0.5f, depth);
     }
 }
\ No newline at end of file
@@ -2,66 +2,224 @@
 #define SPC_COLLISION_DETECTION_ASP_HPP
 
 
-// Forward declarations.
-namespace tyga { class Actor; class Vector3; }
+// Personal headers.
+#include <Physics/Collider.hpp>
+#include <Physics/Contact.hpp>
 
 
 namespace spc
 {
-    // Forward declarations.
-    class PhysicsObject;
-    class PhysicsBox;
-    class PhysicsPlane;
-    class PhysicsSphere;
+    /// <summary>
+    /// Registers the function which tests a combination of collider types. A specialisation sets defined to true and
+    /// provides a static collide function which takes the colliders in the order of the template arguments. Each
+    /// combination only needs registering in one order, the dispatch table handles the other order by swapping them.
+    /// New types are supported by adding them to PhysicsObject::Type and specialising this for each combination.
+    /// </summary>
+    template <PhysicsObject::Type Lhs, PhysicsObject::Type Rhs> 
+    struct CollisionHandler final
+    {
+        static const bool defined = false;  //!< Combinations without a handler never collide.
+    };
 
 
     /// <summary>
-    /// A static class which handles the collision detection of various different PhysicsObject types.
+    /// A static class which handles the collision detection of various different PhysicsObject types. Objects are
+    /// tested using the world space Collider built for them by the PhysicsSystem at the start of each step.
     /// </summary>
     class CollisionDetection final
     {
         public:
 
+            /// <summary> A function which tests two colliders of a known combination of types. </summary>
+            using Handler = bool (*) (const Collider& lhs, const Collider& rhs, ContactManifold& manifold);
+
+
             //////////////////////
             // Public interface //
             //////////////////////
 
-            /// <summary> Detects if any collision has happened between two PhysicsObject types. </summary>
-            static void detectCollision (PhysicsObject& lhs, PhysicsObject& rhs);
+            /// <summary> 
+            /// Looks up the function which tests a combination of types in a table generated at compile time from every
+            /// registered CollisionHandler. Testing a batch of pairs with the same types through one handler avoids
+            /// dispatching each pair. Unlike detectCollision the handler doesn't check whether the objects are attached.
+            /// </summary>
+            /// <param name="lhs"> The type of the first collider passed to the handler. </param>
+            /// <param name="rhs"> The type of the second collider passed to the handler. </param>
+            /// <returns> The handler, which fills the manifold with the normal pointing from lhs towards rhs. </returns>
+            static Handler getHandler (const PhysicsObject::Type lhs, const PhysicsObject::Type rhs);
+
+            /// <summary> 
+            /// Checks whether a combination of types is in the order a CollisionHandler was registered with, pairs in
+            /// this order are tested directly whereas pairs in the other order have to be swapped and flipped.
+            /// </summary>
+            /// <param name="lhs"> The type of the first collider. </param>
+            /// <param name="rhs"> The type of the second collider. </param>
+            /// <returns> Whether the types are in canonical order, combinations without a handler always are. </returns>
+            static bool isCanonical (const PhysicsObject::Type lhs, const PhysicsObject::Type rhs);
+
+            /// <summary> 
+            /// Tests whether two colliders are touching without modifying either of them, so pairs can be tested on
+            /// multiple threads at once. Any contacts are written to the manifold with the normal pointing from lhs
+            /// towards rhs.
+            /// </summary>
+            /// <param name="lhs"> The first object. </param>
+            /// <param name="rhs"> The second object. </param>
+            /// <param name="manifold"> 
+            /// The manifold to fill. If there is no collision the normal is an axis which separated the objects, or zero
+            /// if no such axis was found, and the rest of its contents are unspecified.
+            /// </param>
+            /// <returns> Whether the objects collided. </returns>
+            static bool detectCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold);
+
+            /// <summary> 
+            /// Tests whether an axis separates two objects, which is much cheaper than a full test when the axis came
+            /// from an earlier failed test and the objects have barely moved since.
+            /// </summary>
+            /// <param name="lhs"> The first object. </param>
+            /// <param name="rhs"> The second object. </param>
+            /// <param name="axis"> The unit axis to project both objects onto. </param>
+            /// <returns> Whether the projections of the objects don't overlap, false means they may be touching. </returns>
+            static bool isSeparated (const Collider& lhs, const Collider& rhs, const math::Vector3& axis);
+
+            /// <summary> Finds when a moving sphere first touches a plane, if it starts above the plane. </summary>
+            /// <param name="sphere"> The sphere at the start of its motion. </param>
+            /// <param name="motion"> How far the sphere moves. </param>
+            /// <param name="plane"> The plane, which doesn't move. </param>
+            /// <param name="time"> Set to the fraction of the motion completed at the moment of impact. </param>
+            /// <returns> Whether the sphere hits the plane during the motion. </returns>
+            static bool sweepSpherePlane (const Collider& sphere, const math::Vector3& motion, const Collider& plane, float& time);
+
+            /// <summary> 
+            /// Finds when two moving spheres first touch, if they start apart. Both are assumed to move in a straight
+            /// line at a constant speed, so the test is done on their relative motion.
+            /// </summary>
+            /// <param name="lhs"> The first sphere at the start of its motion. </param>
+            /// <param name="lhsMotion"> How far the first sphere moves. </param>
+            /// <param name="rhs"> The second sphere at the start of its motion. </param>
+            /// <param name="rhsMotion"> How far the second sphere moves. </param>
+            /// <param name="time"> Set to the fraction of the motion completed at the moment of impact. </param>
+            /// <returns> Whether the spheres hit each other during the motion. </returns>
+            static bool sweepSphereSphere (const Collider& lhs, const math::Vector3& lhsMotion, 
+                                           const Collider& rhs, const math::Vector3& rhsMotion, float& time);
 
         private:
 
-            /// <summary> Cast two objects to the specified types and pass them to the desired function. </summary>
-            /// <param name="lhs"> The object to be cast to T. </param>
-            /// <param name="rhs"> The object to be cast to U. </param>
-            /// <param name="function"> The function to pass the objects to. </param>
-            template <typename T, typename U, typename V> 
-            static void passToFunction (PhysicsObject& lhs, PhysicsObject& rhs, const V& function);
-            
-            /// <summary> Handles sphere on sphere collision. </summary>
-            static void sphereSphereCollision (PhysicsSphere& lhs, PhysicsSphere& rhs);
+            // Registered handlers need access to the functions below.
+            template <PhysicsObject::Type Lhs, PhysicsObject::Type Rhs> friend struct CollisionHandler;
 
-            /// <summary> Handles sphere on box collision. </summary>
-            static void sphereBoxCollision (PhysicsSphere& sphere, PhysicsBox& box);
+            /// <summary> Handles sphere on sphere collision. Each handler returns whether the objects collided. </summary>
+            static bool sphereSphereCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold);
+
+            /// <summary> Handles sphere on box collision by finding the point on the box closest to the centre of the sphere. </summary>
+            static bool sphereBoxCollision (const Collider& sphere, const Collider& box, ContactManifold& manifold);
 
             /// <summary> Handles sphere on plane collision. </summary>
-            static void spherePlaneCollision (PhysicsSphere& sphere, PhysicsPlane& plane);
+            static bool spherePlaneCollision (const Collider& sphere, const Collider& plane, ContactManifold& manifold);
 
-            /// <summary> Handles box on box collision. </summary>
-            static void boxBoxCollision (PhysicsBox& lhs, PhysicsBox& rhs);
+            /// <summary> 
+            /// Handles box on box collision by testing the 3 face axes of each box and the 9 cross products of their
+            /// edges. The axis of least penetration decides whether the boxes touch along a face or a pair of edges.
+            /// </summary>
+            static bool boxBoxCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold);
 
-            /// <summary> Handles box on plane collision. </summary>
-            static void boxPlaneCollision (PhysicsBox& box, PhysicsPlane& plane);
+            /// <summary> Handles box on plane collision by testing each corner of the box against the plane. </summary>
+            static bool boxPlaneCollision (const Collider& box, const Collider& plane, ContactManifold& manifold);
 
             /// <summary> Handles plane on plane collision. </summary>
-            static void planePlaneCollision (PhysicsPlane& lhs, PhysicsPlane& rhs);
+            static bool planePlaneCollision (const Collider& lhs, const Collider& rhs, ContactManifold& manifold);
+
+            /// <summary> 
+            /// Creates the contacts of two boxes touching on a face of the reference box. The face of the incident box
+            /// which faces the reference face the most is clipped against the sides of the reference face, then every
+            /// point below the reference face becomes a contact.
+            /// </summary>
+            /// <param name="reference"> The box which owns the face. </param>
+            /// <param name="axis"> The axis of the reference box which the face is on. </param>
+            /// <param name="normal"> The direction of the face, pointing out of the reference box towards the incident box. </param>
+            /// <param name="incident"> The other box. </param>
+            /// <param name="manifold"> The manifold to add the contacts to. </param>
+            static void boxFaceContacts (const Collider& reference, const unsigned int axis, const math::Vector3& normal, 
+                                         const Collider& incident, ContactManifold& manifold);
+
+            /// <summary> Creates the contact of two boxes touching on an edge of each, at the closest points of both edges. </summary>
+            /// <param name="lhs"> The first box. </param>
+            /// <param name="lhsAxis"> The axis of the first box which its edge runs along. </param>
+            /// <param name="rhs"> The second box. </param>
+            /// <param name="rhsAxis"> The axis of the second box which its edge runs along. </param>
+            /// <param name="normal"> The direction from the first box towards the second. </param>
+            /// <param name="depth"> How far the boxes overlap along the normal. </param>
+            /// <param name="manifold"> The manifold to add the contact to. </param>
+            static void boxEdgeContact (const Collider& lhs, const unsigned int lhsAxis, const Collider& rhs, const unsigned int rhsAxis, 
+                                        const math::Vector3& normal, const float depth, ContactManifold& manifold);
+    };
 
-            /// <summary> Performs collision response on the two given objects. </summary>
-            /// <param name="lhs"> The first object. </param>
-            /// <param name="rhs"> The second second. </param>
-            /// <param name="normal"> The normal vector of the collision. </param>
-            /// <param name="intersection"> How much the objects are colliding by. </param>
-            static void collisionResponse (PhysicsObject& lhs, PhysicsObject& rhs, const tyga::Vector3& normal, const float intersection);
+    ///////////////////////
+    // Built in handlers //
+    ///////////////////////
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Sphere, PhysicsObject::Type::Sphere> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::sphereSphereCollision (lhs, rhs, manifold);
+        }
+    };
+
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Sphere, PhysicsObject::Type::Box> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::sphereBoxCollision (lhs, rhs, manifold);
+        }
+    };
+
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Sphere, PhysicsObject::Type::Plane> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::spherePlaneCollision (lhs, rhs, manifold);
+        }
+    };
+
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Box, PhysicsObject::Type::Box> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::boxBoxCollision (lhs, rhs, manifold);
+        }
+    };
+
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Box, PhysicsObject::Type::Plane> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::boxPlaneCollision (lhs, rhs, manifold);
+        }
+    };
+
+
+    template <> struct CollisionHandler<PhysicsObject::Type::Plane, PhysicsObject::Type::Plane> final
+    {
+        static const bool defined = true;
+
+        static bool collide (const Collider& lhs, const Collider& rhs, ContactManifold& manifold)
+        {
+            return CollisionDetection::planePlaneCollision (lhs, rhs, manifold);
+        }
     };
 }
 
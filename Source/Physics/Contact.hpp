@@ -0,0 +1,86 @@
+#ifndef SPC_CONTACT_ASP_HPP
+#define SPC_CONTACT_ASP_HPP
+
+
+// STL headers.
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// A single point at which two objects are touching.
+    /// </summary>
+    struct Contact final
+    {
+        math::Vector3   point           { };        //!< The world space position of the contact, halfway between both surfaces.
+        float           depth           { 0.f };    //!< How far the objects are overlapping at this point.
+        float           normalImpulse   { 0.f };    //!< The impulse accumulated by the solver, kept between ticks for warm starting.
+        float           pseudoImpulse   { 0.f };    //!< The position correction impulse accumulated when using split impulses.
+        float           normalMass      { 0.f };    //!< The reciprocal of the combined inverse mass along the normal.
+        float           velocityBias    { 0.f };    //!< The separating velocity the solver aims for, from restitution and Baumgarte.
+        float           positionBias    { 0.f };    //!< The separating pseudo velocity the solver aims for when using split impulses.
+    };
+
+
+    /// <summary>
+    /// Every contact between two objects found by the narrowphase. The normal points from the first object of the
+    /// pair towards the second, so moving the second object along it separates them. The body indices and key are
+    /// filled in by the PhysicsSystem for use by the ContactSolver.
+    /// </summary>
+    struct ContactManifold final
+    {
+        static const unsigned int maxContacts = 4;  //!< The most contacts a manifold can hold, enough to keep a box face stable.
+
+        std::array<Contact, maxContacts>    contacts        { };        //!< The points of contact, only the first contactCount are valid.
+        unsigned int                        contactCount    { 0 };      //!< How many contacts are valid.
+        math::Vector3                       normal          { };        //!< The unit direction from the first object towards the second.
+        unsigned int                        pair            { 0 };      //!< The index of the broadphase pair which produced the manifold.
+        unsigned int                        lhsBody         { 0 };      //!< The BodyStore index of the first object.
+        unsigned int                        rhsBody         { 0 };      //!< The BodyStore index of the second object.
+        std::uint64_t                       key             { 0 };      //!< Identifies the pair of objects across ticks, made from both IDs.
+
+
+        /// <summary> Adds a point of contact to the manifold. </summary>
+        /// <param name="point"> The world space position of the contact. </param>
+        /// <param name="depth"> How far the objects overlap at the point. </param>
+        void addContact (const math::Vector3& point, const float depth)
+        {
+            // Pre-condition: There is room for the contact.
+            assert (contactCount < maxContacts);
+
+            auto& contact = contacts[contactCount++];
+            contact       = Contact { };
+            contact.point = point;
+            contact.depth = depth;
+        }
+
+        /// <summary> Finds the deepest overlap in the manifold. </summary>
+        /// <returns> The greatest depth of any contact, zero if there are none. </returns>
+        float maxDepth() const
+        {
+            auto depth = 0.f;
+
+            for (auto i = 0U; i < contactCount; ++i)
+            {
+                depth = contacts[i].depth > depth ? contacts[i].depth : depth;
+            }
+
+            return depth;
+        }
+
+        /// <summary> Reverses the direction of the manifold, used when the objects were tested in the opposite order. </summary>
+        void flip()
+        {
+            normal = -normal;
+        }
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "ContactCache.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <utility>
+
+
+namespace spc
+{
+    // The capacity of a table the first time anything is inserted.
+    static const auto initialCapacity = 64U;
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    ContactCache::ContactCache (ContactCache&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    ContactCache& ContactCache::operator= (ContactCache&& move)
+    {
+        if (this != &move)
+        {
+            m_tables    = std::move (move.m_tables);
+            m_current   = move.m_current;
+
+            move.clear();
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    std::uint64_t ContactCache::makeKey (const unsigned int lhs, const unsigned int rhs)
+    {
+        return (static_cast<std::uint64_t> (std::min (lhs, rhs)) << 32) | std::max (lhs, rhs);
+    }
+
+
+    const ContactCache::Entry* ContactCache::find (const std::uint64_t key) const
+    {
+        const auto& table = m_tables[m_current ^ 1];
+
+        if (table.count == 0)
+        {
+            return nullptr;
+        }
+
+        // The table is never more than half full so an empty slot will always be found.
+        const auto mask = table.slots.size() - 1;
+
+        for (auto slot = hash (key) & mask; table.slots[slot].generation == table.generation; slot = (slot + 1) & mask)
+        {
+            if (table.slots[slot].key == key)
+            {
+                return &table.slots[slot];
+            }
+        }
+
+        return nullptr;
+    }
+
+
+    ContactCache::Entry& ContactCache::insert (const std::uint64_t key)
+    {
+        auto& table = m_tables[m_current];
+
+        if ((table.count + 1) * 2 > table.slots.size())
+        {
+            grow (table);
+        }
+
+        const auto mask = table.slots.size() - 1;
+        auto slot       = hash (key) & mask;
+
+        while (table.slots[slot].generation == table.generation)
+        {
+            if (table.slots[slot].key == key)
+            {
+                return table.slots[slot];
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        // Claim the empty slot.
+        auto& entry         = table.slots[slot];
+        entry               = Entry { };
+        entry.key           = key;
+        entry.generation    = table.generation;
+        ++table.count;
+
+        return entry;
+    }
+
+
+    void ContactCache::advance()
+    {
+        // The old table of the last step becomes the new table of this step.
+        m_current ^= 1;
+        reset (m_tables[m_current]);
+    }
+
+
+    void ContactCache::clear()
+    {
+        reset (m_tables[0]);
+        reset (m_tables[1]);
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    std::uint64_t ContactCache::hash (const std::uint64_t key)
+    {
+        // The splitmix64 finaliser, IDs are sequential so they need mixing before being masked.
+        auto mixed = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        mixed      = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+
+        return mixed ^ (mixed >> 31);
+    }
+
+
+    void ContactCache::reset (Table& table)
+    {
+        table.count = 0;
+
+        // Slots default to generation zero so that must never be a valid generation.
+        if (++table.generation == 0)
+        {
+            for (auto& slot : table.slots)
+            {
+                slot.generation = 0;
+            }
+
+            table.generation = 1;
+        }
+    }
+
+
+    void ContactCache::grow (Table& table)
+    {
+        auto slots = std::vector<Entry> (std::max (table.slots.size() * 2, static_cast<std::size_t> (initialCapacity)));
+        const auto mask = slots.size() - 1;
+
+        for (const auto& entry : table.slots)
+        {
+            if (entry.generation == table.generation)
+            {
+                auto slot = hash (entry.key) & mask;
+
+                while (slots[slot].generation == table.generation)
+                {
+                    slot = (slot + 1) & mask;
+                }
+
+                slots[slot] = entry;
+            }
+        }
+
+        table.slots = std::move (slots);
+    }
+}
\ No newline at end of file
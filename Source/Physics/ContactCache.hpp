@@ -0,0 +1,121 @@
+#ifndef SPC_CONTACT_CACHE_ASP_HPP
+#define SPC_CONTACT_CACHE_ASP_HPP
+
+
+// STL headers.
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/Contact.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// Remembers what the narrowphase and solver learnt about each pair of objects so the next step can reuse it. Pairs
+    /// which were touching keep their contacts and accumulated impulses for warm starting, pairs which weren't keep the
+    /// axis which separated them so the narrowphase can skip them while it still does. Entries live in an open addressing
+    /// table keyed by the IDs of both objects. Two tables are kept, the last step is read from one while this step is
+    /// written to the other, so anything not written this step is forgotten when they're swapped.
+    /// </summary>
+    class ContactCache final
+    {
+        public:
+
+            /// <summary>
+            /// Everything known about a pair of objects from a single step.
+            /// </summary>
+            struct Entry final
+            {
+                std::uint64_t                                           key         { 0 };      //!< The pair the entry belongs to.
+                unsigned int                                            generation  { 0 };      //!< The entry is only valid when this matches the generation of its table.
+                bool                                                    separated   { false };  //!< Whether axis separated the objects.
+                math::Vector3                                           axis        { };        //!< A unit axis which the objects didn't overlap on.
+                unsigned int                                            count       { 0 };      //!< How many contacts were cached.
+                math::Vector3                                           normal      { };        //!< The normal of the manifold.
+                std::array<math::Vector3, ContactManifold::maxContacts> points      { };        //!< The position of each contact.
+                std::array<float, ContactManifold::maxContacts>         impulses    { };        //!< The accumulated impulse of each contact.
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ContactCache()                                          = default;
+
+            ContactCache (ContactCache&& move);
+            ContactCache& operator= (ContactCache&& move);
+
+            ContactCache (const ContactCache& copy)                 = default;
+            ContactCache& operator= (const ContactCache& copy)      = default;
+            ~ContactCache()                                         = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Creates the key of a pair of objects, the order of the IDs doesn't matter. </summary>
+            /// <param name="lhs"> The ID of one object. </param>
+            /// <param name="rhs"> The ID of the other object. </param>
+            /// <returns> A key unique to the pair. </returns>
+            static std::uint64_t makeKey (const unsigned int lhs, const unsigned int rhs);
+
+            /// <summary> Gets how many pairs have been written this step. </summary>
+            /// <returns> The number of valid entries in the current table. </returns>
+            unsigned int size() const                               { return m_tables[m_current].count; }
+
+            /// <summary> Looks up what was learnt about a pair last step, this never modifies the cache so it's safe to call from many threads. </summary>
+            /// <param name="key"> The key of the pair. </param>
+            /// <returns> The entry from last step, nullptr if the pair wasn't cached. </returns>
+            const Entry* find (const std::uint64_t key) const;
+
+            /// <summary> Obtains the entry of a pair for this step, the entry is reset the first time it's inserted each step. </summary>
+            /// <param name="key"> The key of the pair. </param>
+            /// <returns> The entry to fill in, only valid until the next insertion. </returns>
+            Entry& insert (const std::uint64_t key);
+
+            /// <summary> Ends the step, what was written becomes readable and everything from the previous step is evicted. </summary>
+            void advance();
+
+            /// <summary> Forgets every cached pair. </summary>
+            void clear();
+
+        private:
+
+            /// <summary>
+            /// An open addressing hash table which is cleared by incrementing its generation.
+            /// </summary>
+            struct Table final
+            {
+                std::vector<Entry>  slots       { };    //!< A power of two number of slots, using linear probing.
+                unsigned int        generation  { 1 };  //!< Slots from any other generation are empty.
+                unsigned int        count       { 0 };  //!< How many slots are valid.
+            };
+
+
+            /// <summary> Hashes a key into a well distributed slot index. </summary>
+            static std::uint64_t hash (const std::uint64_t key);
+
+            /// <summary> Empties a table without touching its slots, unless the generation wraps around. </summary>
+            static void reset (Table& table);
+
+            /// <summary> Doubles the capacity of a table, keeping every valid entry. </summary>
+            static void grow (Table& table);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::array<Table, 2>    m_tables    { };    //!< The tables of the last step and this step.
+            unsigned int            m_current   { 0 };  //!< The index of the table being written to this step.
+    };
+}
+
+#endif
\ No newline at end of file
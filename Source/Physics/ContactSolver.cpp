@@ -0,0 +1,342 @@
+#include "ContactSolver.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+
+// Personal headers.
+#include <Physics/BodyStore.hpp>
+#include <Physics/ContactCache.hpp>
+
+
+namespace spc
+{
+    // Approach speeds below this don't bounce, otherwise resting objects would never settle.
+    static const auto restitutionThreshold = 1.f;
+
+    // Cached contacts further than this from a new contact aren't considered to be the same point.
+    static const auto matchDistanceSqr = 0.05f * 0.05f;
+
+    // Manifolds whose normal has turned further than this since the last step aren't warm started.
+    static const auto matchNormalDot = 0.95f;
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    ContactSolver::ContactSolver (ContactSolver&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    ContactSolver& ContactSolver::operator= (ContactSolver&& move)
+    {
+        if (this != &move)
+        {
+            m_iterations    = move.m_iterations;
+            m_correction    = move.m_correction;
+            m_factor        = move.m_factor;
+            m_slop          = move.m_slop;
+            m_warmStarting  = move.m_warmStarting;
+            m_pseudoX       = std::move (move.m_pseudoX);
+            m_pseudoY       = std::move (move.m_pseudoY);
+            m_pseudoZ       = std::move (move.m_pseudoZ);
+        }
+
+        return *this;
+    }
+
+
+    /////////////////////
+    // Solver settings //
+    /////////////////////
+
+    void ContactSolver::setIterations (const unsigned int iterations)
+    {
+        if (iterations > 0)
+        {
+            m_iterations = iterations;
+        }
+    }
+
+
+    void ContactSolver::setCorrectionFactor (const float factor)
+    {
+        if (factor >= 0.f && factor <= 1.f)
+        {
+            m_factor = factor;
+        }
+    }
+
+
+    void ContactSolver::setSlop (const float slop)
+    {
+        if (slop >= 0.f)
+        {
+            m_slop = slop;
+        }
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void ContactSolver::beginStep (std::vector<ContactManifold>& manifolds, const unsigned int bodyCount, const ContactCache& cache)
+    {
+        // Pseudo velocities only exist for the duration of a step.
+        if (m_correction == PositionCorrection::SplitImpulse)
+        {
+            m_pseudoX.assign (bodyCount, 0.f);
+            m_pseudoY.assign (bodyCount, 0.f);
+            m_pseudoZ.assign (bodyCount, 0.f);
+        }
+
+        if (!m_warmStarting)
+        {
+            return;
+        }
+
+        // Give each contact the impulse of the closest contact cached from the last step.
+        for (auto& manifold : manifolds)
+        {
+            const auto cached = cache.find (manifold.key);
+
+            // The objects may have been tested in the opposite order so the normal could be reversed.
+            if (!cached || cached->count == 0 || std::abs (math::dot (cached->normal, manifold.normal)) < matchNormalDot)
+            {
+                continue;
+            }
+
+            for (auto i = 0U; i < manifold.contactCount; ++i)
+            {
+                auto& contact = manifold.contacts[i];
+                auto closest  = matchDistanceSqr;
+
+                for (auto j = 0U; j < cached->count; ++j)
+                {
+                    const auto offset   = contact.point - cached->points[j];
+                    const auto distance = math::dot (offset, offset);
+
+                    if (distance < closest)
+                    {
+                        closest               = distance;
+                        contact.normalImpulse = cached->impulses[j];
+                    }
+                }
+            }
+        }
+    }
+
+
+    void ContactSolver::solveIsland (BodyStore& bodies, std::vector<ContactManifold>& manifolds, const unsigned int* begin, const unsigned int* end, const float deltaTime)
+    {
+        for (auto i = begin; i != end; ++i)
+        {
+            prepare (bodies, manifolds[*i], deltaTime);
+        }
+
+        // Each iteration brings the velocity of every contact closer to the target of every other.
+        for (auto iteration = 0U; iteration < m_iterations; ++iteration)
+        {
+            for (auto i = begin; i != end; ++i)
+            {
+                solveVelocity (bodies, manifolds[*i]);
+            }
+        }
+
+        if (m_correction == PositionCorrection::SplitImpulse)
+        {
+            for (auto iteration = 0U; iteration < m_iterations; ++iteration)
+            {
+                for (auto i = begin; i != end; ++i)
+                {
+                    solvePosition (bodies, manifolds[*i]);
+                }
+            }
+        }
+    }
+
+
+    void ContactSolver::endStep (BodyStore& bodies, const std::vector<ContactManifold>& manifolds, const float deltaTime, ContactCache& cache)
+    {
+        // Move objects apart with the pseudo velocity, bodies without contacts have a pseudo velocity of zero.
+        if (m_correction == PositionCorrection::SplitImpulse)
+        {
+            // Pre-condition: The body count hasn't changed since beginStep.
+            assert (m_pseudoX.size() == bodies.size());
+
+            for (auto i = 0U; i < bodies.size(); ++i)
+            {
+                bodies.positionX[i] += m_pseudoX[i] * deltaTime;
+                bodies.positionY[i] += m_pseudoY[i] * deltaTime;
+                bodies.positionZ[i] += m_pseudoZ[i] * deltaTime;
+            }
+        }
+
+        // Remember the impulses for next step, pairs which are no longer touching are forgotten by the cache.
+        for (const auto& manifold : manifolds)
+        {
+            auto& cached    = cache.insert (manifold.key);
+            cached.count    = manifold.contactCount;
+            cached.normal   = manifold.normal;
+
+            for (auto i = 0U; i < manifold.contactCount; ++i)
+            {
+                cached.points[i]   = manifold.contacts[i].point;
+                cached.impulses[i] = manifold.contacts[i].normalImpulse;
+            }
+        }
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    void ContactSolver::prepare (BodyStore& bodies, ContactManifold& manifold, const float deltaTime)
+    {
+        const auto lhs          = manifold.lhsBody;
+        const auto rhs          = manifold.rhsBody;
+        const auto lhsInvMass   = inverseMass (bodies, lhs);
+        const auto rhsInvMass   = inverseMass (bodies, rhs);
+        const auto totalInvMass = lhsInvMass + rhsInvMass;
+        const auto& normal      = manifold.normal;
+
+        // The most bouncy object decides how much the pair bounces.
+        const auto approach    = math::dot (bodies.velocity (rhs) - bodies.velocity (lhs), normal);
+        const auto restitution = std::max (bodies.restitution[lhs], bodies.restitution[rhs]);
+        const auto bounce      = approach < -restitutionThreshold ? -restitution * approach : 0.f;
+
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            auto& contact = manifold.contacts[i];
+
+            // Correct a fraction of the penetration beyond the slop each step.
+            const auto correction = std::max (contact.depth - m_slop, 0.f) * m_factor / deltaTime;
+
+            contact.normalMass    = totalInvMass > 0.f ? 1.f / totalInvMass : 0.f;
+            contact.pseudoImpulse = 0.f;
+
+            if (m_correction == PositionCorrection::Baumgarte)
+            {
+                contact.velocityBias = std::max (bounce, correction);
+                contact.positionBias = 0.f;
+            }
+
+            else
+            {
+                contact.velocityBias = bounce;
+                contact.positionBias = correction;
+            }
+
+            // Apply the impulse from last step, the solver then only needs to correct the difference.
+            if (m_warmStarting)
+            {
+                const auto impulse = normal * contact.normalImpulse;
+
+                applyImpulse (bodies, lhs, lhsInvMass, -impulse);
+                applyImpulse (bodies, rhs, rhsInvMass, impulse);
+            }
+
+            else
+            {
+                contact.normalImpulse = 0.f;
+            }
+        }
+    }
+
+
+    void ContactSolver::solveVelocity (BodyStore& bodies, ContactManifold& manifold)
+    {
+        const auto lhs          = manifold.lhsBody;
+        const auto rhs          = manifold.rhsBody;
+        const auto lhsInvMass   = inverseMass (bodies, lhs);
+        const auto rhsInvMass   = inverseMass (bodies, rhs);
+        const auto& normal      = manifold.normal;
+
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            auto& contact = manifold.contacts[i];
+
+            // Objects can push but never pull, so the total impulse is clamped rather than each individual impulse.
+            const auto velocity = math::dot (bodies.velocity (rhs) - bodies.velocity (lhs), normal);
+            const auto lambda   = contact.normalMass * (contact.velocityBias - velocity);
+            const auto total    = std::max (contact.normalImpulse + lambda, 0.f);
+            const auto impulse  = normal * (total - contact.normalImpulse);
+
+            contact.normalImpulse = total;
+
+            applyImpulse (bodies, lhs, lhsInvMass, -impulse);
+            applyImpulse (bodies, rhs, rhsInvMass, impulse);
+        }
+    }
+
+
+    void ContactSolver::solvePosition (const BodyStore& bodies, ContactManifold& manifold)
+    {
+        const auto lhs          = manifold.lhsBody;
+        const auto rhs          = manifold.rhsBody;
+        const auto lhsInvMass   = inverseMass (bodies, lhs);
+        const auto rhsInvMass   = inverseMass (bodies, rhs);
+        const auto& normal      = manifold.normal;
+
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            auto& contact = manifold.contacts[i];
+
+            // The same as the velocity constraint but acting on the pseudo velocity.
+            const auto velocity = (m_pseudoX[rhs] - m_pseudoX[lhs]) * normal.x +
+                                  (m_pseudoY[rhs] - m_pseudoY[lhs]) * normal.y +
+                                  (m_pseudoZ[rhs] - m_pseudoZ[lhs]) * normal.z;
+
+            const auto lambda   = contact.normalMass * (contact.positionBias - velocity);
+            const auto total    = std::max (contact.pseudoImpulse + lambda, 0.f);
+            const auto impulse  = normal * (total - contact.pseudoImpulse);
+
+            contact.pseudoImpulse = total;
+
+            applyPseudoImpulse (lhs, lhsInvMass, -impulse);
+            applyPseudoImpulse (rhs, rhsInvMass, impulse);
+        }
+    }
+
+
+    void ContactSolver::applyPseudoImpulse (const unsigned int body, const float inverseMass, const math::Vector3& impulse)
+    {
+        // Immovable bodies may be shared between islands so they must never be written to.
+        if (inverseMass > 0.f)
+        {
+            m_pseudoX[body] += impulse.x * inverseMass;
+            m_pseudoY[body] += impulse.y * inverseMass;
+            m_pseudoZ[body] += impulse.z * inverseMass;
+        }
+    }
+
+
+    float ContactSolver::inverseMass (const BodyStore& bodies, const unsigned int body)
+    {
+        const auto simulated = BodyStore::Alive | BodyStore::Attached;
+        const auto relevant  = simulated | BodyStore::Static | BodyStore::Sleeping;
+
+        return (bodies.flags[body] & relevant) == simulated ? bodies.inverseMass[body] : 0.f;
+    }
+
+
+    void ContactSolver::applyImpulse (BodyStore& bodies, const unsigned int body, const float inverseMass, const math::Vector3& impulse)
+    {
+        // Immovable bodies may be shared between islands so they must never be written to.
+        if (inverseMass > 0.f)
+        {
+            bodies.velocityX[body] += impulse.x * inverseMass;
+            bodies.velocityY[body] += impulse.y * inverseMass;
+            bodies.velocityZ[body] += impulse.z * inverseMass;
+        }
+    }
+}
\ No newline at end of file
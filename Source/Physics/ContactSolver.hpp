@@ -0,0 +1,176 @@
+#ifndef SPC_CONTACT_SOLVER_ASP_HPP
+#define SPC_CONTACT_SOLVER_ASP_HPP
+
+
+// STL headers.
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Contact.hpp>
+
+
+namespace spc
+{
+    // Forward declarations.
+    class BodyStore;
+    class ContactCache;
+
+
+    /// <summary>
+    /// A sequential impulse solver which resolves contact manifolds by repeatedly applying impulses along each contact
+    /// normal until the objects are no longer approaching each other. Accumulated impulses are kept in a ContactCache
+    /// between ticks and used to warm start the next tick, which lets resting and stacked objects settle in very few iterations.
+    /// Only translation is simulated by the PhysicsSystem so impulses only affect linear velocity.
+    /// </summary>
+    class ContactSolver final
+    {
+        public:
+
+            /// <summary>
+            /// How penetration between objects is removed.
+            /// </summary>
+            enum class PositionCorrection : int
+            {
+                Baumgarte       = 0,    //!< A bias is added to the velocity constraint, cheap but adds energy to the objects.
+                SplitImpulse    = 1     //!< A separate pseudo velocity moves the objects apart and is then discarded.
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ContactSolver()                                         = default;
+
+            ContactSolver (ContactSolver&& move);
+            ContactSolver& operator= (ContactSolver&& move);
+
+            ContactSolver (const ContactSolver& copy)               = default;
+            ContactSolver& operator= (const ContactSolver& copy)    = default;
+            ~ContactSolver()                                        = default;
+
+
+            /////////////////////
+            // Solver settings //
+            /////////////////////
+
+            /// <summary> Gets how many times every contact is visited each step. </summary>
+            /// <returns> The number of velocity iterations. </returns>
+            unsigned int getIterations() const                                  { return m_iterations; }
+
+            /// <summary> Sets how many times every contact is visited each step, more iterations give stiffer stacks. </summary>
+            /// <param name="iterations"> The number of iterations, zero will be ignored. </param>
+            void setIterations (const unsigned int iterations);
+
+            /// <summary> Gets how penetration between objects is removed. </summary>
+            /// <returns> The position correction method. </returns>
+            PositionCorrection getPositionCorrection() const                    { return m_correction; }
+
+            /// <summary> Sets how penetration between objects is removed. </summary>
+            /// <param name="correction"> The new position correction method. </param>
+            void setPositionCorrection (const PositionCorrection correction)    { m_correction = correction; }
+
+            /// <summary> Gets the fraction of the penetration which is corrected each step. </summary>
+            /// <returns> The correction factor. </returns>
+            float getCorrectionFactor() const                                   { return m_factor; }
+
+            /// <summary> Sets the fraction of the penetration which is corrected each step. </summary>
+            /// <param name="factor"> A value from 0 to 1, values outside of this range will be ignored. </param>
+            void setCorrectionFactor (const float factor);
+
+            /// <summary> Gets how far objects may overlap before position correction is applied. </summary>
+            /// <returns> The allowed penetration. </returns>
+            float getSlop() const                                               { return m_slop; }
+
+            /// <summary> Sets how far objects may overlap before position correction is applied, this prevents jitter. </summary>
+            /// <param name="slop"> The allowed penetration, values below zero will be ignored. </param>
+            void setSlop (const float slop);
+
+            /// <summary> Gets whether cached impulses from the previous tick are applied before solving. </summary>
+            /// <returns> Whether warm starting is enabled. </returns>
+            bool isWarmStarting() const                                         { return m_warmStarting; }
+
+            /// <summary> Sets whether cached impulses from the previous tick are applied before solving. </summary>
+            /// <param name="warmStarting"> Whether to enable warm starting. </param>
+            void setWarmStarting (const bool warmStarting)                      { m_warmStarting = warmStarting; }
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary>
+            /// Prepares for a new step, copying cached impulses into the contacts of each manifold and clearing the
+            /// pseudo velocities. This must be called before any island is solved.
+            /// </summary>
+            /// <param name="manifolds"> Every manifold found this step, with bodies and keys filled in. </param>
+            /// <param name="bodyCount"> How many bodies are in the store. </param>
+            /// <param name="cache"> Contains the impulses of each manifold from last step. </param>
+            void beginStep (std::vector<ContactManifold>& manifolds, const unsigned int bodyCount, const ContactCache& cache);
+
+            /// <summary>
+            /// Solves a group of manifolds which share no moving bodies with any other group, so groups can be solved
+            /// at the same time on different threads.
+            /// </summary>
+            /// <param name="bodies"> The store containing the velocity of each body. </param>
+            /// <param name="manifolds"> Every manifold found this step. </param>
+            /// <param name="begin"> The first index into manifolds to solve. </param>
+            /// <param name="end"> One past the last index into manifolds to solve. </param>
+            /// <param name="deltaTime"> The length of the step being simulated. </param>
+            void solveIsland (BodyStore& bodies, std::vector<ContactManifold>& manifolds, const unsigned int* begin, const unsigned int* end, const float deltaTime);
+
+            /// <summary> Applies any split impulse corrections and caches the accumulated impulses for the next step. </summary>
+            /// <param name="bodies"> The store containing the position of each body. </param>
+            /// <param name="manifolds"> Every manifold solved this step. </param>
+            /// <param name="deltaTime"> The length of the step being simulated. </param>
+            /// <param name="cache"> Where the impulses of each manifold are written for the next step. </param>
+            void endStep (BodyStore& bodies, const std::vector<ContactManifold>& manifolds, const float deltaTime, ContactCache& cache);
+
+        private:
+
+            /// <summary> Calculates the mass and bias of each contact and applies any warm starting impulse. </summary>
+            void prepare (BodyStore& bodies, ContactManifold& manifold, const float deltaTime);
+
+            /// <summary> Runs one iteration of the velocity constraint of every contact in a manifold. </summary>
+            void solveVelocity (BodyStore& bodies, ContactManifold& manifold);
+
+            /// <summary> Runs one iteration of the split impulse position constraint of every contact in a manifold. </summary>
+            void solvePosition (const BodyStore& bodies, ContactManifold& manifold);
+
+            /// <summary> Changes the pseudo velocity of a body by an impulse. </summary>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="inverseMass"> The inverse mass of the body, nothing is written if this is zero. </param>
+            /// <param name="impulse"> The impulse to apply. </param>
+            void applyPseudoImpulse (const unsigned int body, const float inverseMass, const math::Vector3& impulse);
+
+            /// <summary> Gets the inverse mass of a body as seen by the solver, immovable bodies have zero. </summary>
+            /// <param name="bodies"> The store containing the body. </param>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> The inverse mass. </returns>
+            static float inverseMass (const BodyStore& bodies, const unsigned int body);
+
+            /// <summary> Changes the velocity of a body by an impulse. </summary>
+            /// <param name="bodies"> The store containing the body. </param>
+            /// <param name="body"> The index of the body. </param>
+            /// <param name="inverseMass"> The inverse mass of the body, nothing is written if this is zero. </param>
+            /// <param name="impulse"> The impulse to apply. </param>
+            static void applyImpulse (BodyStore& bodies, const unsigned int body, const float inverseMass, const math::Vector3& impulse);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            unsigned int        m_iterations    { 8 };                                  //!< The number of velocity iterations.
+            PositionCorrection  m_correction    { PositionCorrection::SplitImpulse };   //!< How penetration is removed.
+            float               m_factor        { 0.2f };                               //!< The fraction of penetration corrected each step.
+            float               m_slop          { 0.005f };                             //!< The allowed penetration.
+            bool                m_warmStarting  { true };                               //!< Whether cached impulses are used.
+            std::vector<float>  m_pseudoX       { };                                    //!< The split impulse velocity of each body on the X axis.
+            std::vector<float>  m_pseudoY       { };                                    //!< The split impulse velocity of each body on the Y axis.
+            std::vector<float>  m_pseudoZ       { };                                    //!< The split impulse velocity of each body on the Z axis.
+    };
+}
+
+#endif
\ No newline at end of file
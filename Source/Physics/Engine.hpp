@@ -0,0 +1,149 @@
+#ifndef SPC_ENGINE_ASP_HPP
+#define SPC_ENGINE_ASP_HPP
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+
+
+/// <summary>
+/// Everything the physics core needs from the engine it runs in. Objects are components which read and write the
+/// transformation of the actor they're attached to, the system is a runloop task and the length of each frame comes
+/// from a clock. Normally these are the tyga classes themselves. Defining SPC_HEADLESS replaces them with the minimal
+/// implementations below, so the physics core can be built and driven without a window or renderer.
+/// </summary>
+#if defined (SPC_HEADLESS)
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+namespace spc
+{
+    // Forward declarations.
+    class EngineActor;
+
+
+    /// <summary>
+    /// Something which can be attached to an EngineActor.
+    /// </summary>
+    class EngineComponent
+    {
+        public:
+
+            virtual ~EngineComponent() = default;
+
+            /// <summary> Gets the actor the component is attached to. </summary>
+            /// <returns> The actor, or nullptr if the component isn't attached. </returns>
+            std::shared_ptr<EngineActor> Actor() const              { return m_actor.lock(); }
+
+        private:
+
+            // Actors attach and detach components.
+            friend class EngineActor;
+
+            std::weak_ptr<EngineActor> m_actor { };  //!< The actor the component is attached to.
+    };
+
+
+    /// <summary>
+    /// A transformation which components can be attached to, standing in for an actor in the game world.
+    /// </summary>
+    class EngineActor final : public std::enable_shared_from_this<EngineActor>
+    {
+        public:
+
+            /// <summary> Gets the transformation of the actor. </summary>
+            /// <returns> The world transformation. </returns>
+            const math::Matrix4x4& Transformation() const                       { return m_transformation; }
+
+            /// <summary> Sets the transformation of the actor. </summary>
+            /// <param name="transformation"> The new world transformation. </param>
+            void setTransformation (const math::Matrix4x4& transformation)      { m_transformation = transformation; }
+
+            /// <summary> Attaches a component to the actor, the actor keeps it alive until it's detached. </summary>
+            /// <param name="component"> The component to attach. </param>
+            void attachComponent (const std::shared_ptr<EngineComponent>& component)
+            {
+                component->m_actor = shared_from_this();
+                m_components.push_back (component);
+            }
+
+            /// <summary> Detaches every component from the actor. </summary>
+            void detachComponents()
+            {
+                for (const auto& component : m_components)
+                {
+                    component->m_actor.reset();
+                }
+
+                m_components.clear();
+            }
+
+        private:
+
+            math::Matrix4x4                                 m_transformation    { };    //!< The world transformation.
+            std::vector<std::shared_ptr<EngineComponent>>   m_components        { };    //!< Every attached component.
+    };
+
+
+    /// <summary>
+    /// A task which is run every frame, headless programs call each function themselves.
+    /// </summary>
+    class EngineTask
+    {
+        public:
+
+            virtual ~EngineTask() = default;
+
+            virtual void runloopWillBegin()     = 0;
+            virtual void runloopExecuteTask()   = 0;
+            virtual void runloopDidEnd()        = 0;
+    };
+
+
+    /// <summary>
+    /// Provides the length of each frame, which headless programs set themselves.
+    /// </summary>
+    class EngineClock final
+    {
+        public:
+
+            /// <summary> Gets the length of the current frame. </summary>
+            /// <returns> The frame length in seconds. </returns>
+            static float CurrentTickInterval()                      { return tickInterval(); }
+
+            /// <summary> Sets the length of every following frame. </summary>
+            /// <param name="interval"> The frame length in seconds. </param>
+            static void setTickInterval (const float interval)      { tickInterval() = interval; }
+
+        private:
+
+            static float& tickInterval()
+            {
+                static auto interval = 1.f / 60.f;
+                return interval;
+            }
+    };
+}
+
+#else
+
+// Engine headers.
+#include <tyga/Actor.hpp>
+#include <tyga/BasicWorldClock.hpp>
+#include <tyga/RunloopTaskProtocol.hpp>
+
+
+namespace spc
+{
+    using EngineActor       = tyga::Actor;
+    using EngineComponent   = tyga::ActorComponent;
+    using EngineTask        = tyga::RunloopTaskProtocol;
+    using EngineClock       = tyga::BasicWorldClock;
+}
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "ForceFields.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+
+
+// Personal headers.
+#include <Physics/PhysicsObject.hpp>
+
+
+namespace spc
+{
+    ////////////////////
+    // UniformGravity //
+    ////////////////////
+
+    void UniformGravity::apply (const ForceBatch& batch) const
+    {
+        for (auto i = batch.first; i < batch.last; ++i)
+        {
+            // Simulated bodies always have mass, the weight keeps everything else untouched.
+            const auto mass = weight (batch, i) / std::max (batch.inverseMass[i], 1e-6f);
+
+            batch.forceX[i] += acceleration.x * mass;
+            batch.forceY[i] += acceleration.y * mass;
+            batch.forceZ[i] += acceleration.z * mass;
+        }
+    }
+
+
+    ////////////////
+    // LinearDrag //
+    ////////////////
+
+    void LinearDrag::apply (const ForceBatch& batch) const
+    {
+        for (auto i = batch.first; i < batch.last; ++i)
+        {
+            const auto scale = -coefficient * weight (batch, i);
+
+            batch.forceX[i] += batch.velocityX[i] * scale;
+            batch.forceY[i] += batch.velocityY[i] * scale;
+            batch.forceZ[i] += batch.velocityZ[i] * scale;
+        }
+    }
+
+
+    ///////////////////
+    // QuadraticDrag //
+    ///////////////////
+
+    void QuadraticDrag::apply (const ForceBatch& batch) const
+    {
+        for (auto i = batch.first; i < batch.last; ++i)
+        {
+            const auto vx       = batch.velocityX[i];
+            const auto vy       = batch.velocityY[i];
+            const auto vz       = batch.velocityZ[i];
+            const auto speed    = std::sqrt (vx * vx + vy * vy + vz * vz);
+            const auto scale    = -coefficient * speed * weight (batch, i);
+
+            batch.forceX[i] += vx * scale;
+            batch.forceY[i] += vy * scale;
+            batch.forceZ[i] += vz * scale;
+        }
+    }
+
+
+    ////////////////
+    // WindVolume //
+    ////////////////
+
+    void WindVolume::apply (const ForceBatch& batch) const
+    {
+        for (auto i = batch.first; i < batch.last; ++i)
+        {
+            const auto px       = batch.positionX[i];
+            const auto py       = batch.positionY[i];
+            const auto pz       = batch.positionZ[i];
+            const auto inside   = px >= volume.min.x && px <= volume.max.x &&
+                                  py >= volume.min.y && py <= volume.max.y &&
+                                  pz >= volume.min.z && pz <= volume.max.z;
+            const auto scale    = inside ? coefficient * weight (batch, i) : 0.f;
+
+            batch.forceX[i] += (wind.x - batch.velocityX[i]) * scale;
+            batch.forceY[i] += (wind.y - batch.velocityY[i]) * scale;
+            batch.forceZ[i] += (wind.z - batch.velocityZ[i]) * scale;
+        }
+    }
+
+
+    ////////////////////
+    // PointAttractor //
+    ////////////////////
+
+    void PointAttractor::apply (const ForceBatch& batch) const
+    {
+        const auto sqrRadius    = radius * radius;
+        const auto sqrMinimum   = minDistance * minDistance;
+
+        for (auto i = batch.first; i < batch.last; ++i)
+        {
+            const auto dx       = centre.x - batch.positionX[i];
+            const auto dy       = centre.y - batch.positionY[i];
+            const auto dz       = centre.z - batch.positionZ[i];
+            const auto sqrDist  = dx * dx + dy * dy + dz * dz;
+            const auto clamped  = std::max (sqrDist, sqrMinimum);
+            const auto mass     = weight (batch, i) / std::max (batch.inverseMass[i], 1e-6f);
+
+            // The direction is dx / distance and the acceleration is strength / clamped, combined into one scale.
+            const auto scale    = sqrDist <= sqrRadius && sqrDist > 0.f
+                                ? strength * mass / (clamped * std::sqrt (sqrDist))
+                                : 0.f;
+
+            batch.forceX[i] += dx * scale;
+            batch.forceY[i] += dy * scale;
+            batch.forceZ[i] += dz * scale;
+        }
+    }
+
+
+    ////////////
+    // Spring //
+    ////////////
+
+    void Spring::apply (const ForceBatch& batch) const
+    {
+        // A second end which was never given is the anchor, one which has been destroyed leaves the spring broken.
+        const auto none     = std::weak_ptr<PhysicsObject>();
+        const auto anchored = !second.owner_before (none) && !none.owner_before (second);
+
+        const auto lhs = first.lock();
+        const auto rhs = second.lock();
+
+        if (!lhs || (!rhs && !anchored))
+        {
+            return;
+        }
+
+        const auto a = bodyOf (*lhs);
+        const auto b = rhs ? bodyOf (*rhs) : batch.last;
+
+        const auto inRangeA = a >= batch.first && a < batch.last;
+        const auto inRangeB = rhs && b >= batch.first && b < batch.last;
+
+        // Every range computes the same force, but only the ranges holding an end write it.
+        if (!inRangeA && !inRangeB)
+        {
+            return;
+        }
+
+        const auto endX     = rhs ? batch.positionX[b] : anchor.x;
+        const auto endY     = rhs ? batch.positionY[b] : anchor.y;
+        const auto endZ     = rhs ? batch.positionZ[b] : anchor.z;
+        const auto dx       = endX - batch.positionX[a];
+        const auto dy       = endY - batch.positionY[a];
+        const auto dz       = endZ - batch.positionZ[a];
+        const auto length   = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+        if (length <= 1e-6f)
+        {
+            return;
+        }
+
+        const auto nx       = dx / length;
+        const auto ny       = dy / length;
+        const auto nz       = dz / length;
+
+        // How fast the ends are separating along the spring.
+        const auto rvx      = (rhs ? batch.velocityX[b] : 0.f) - batch.velocityX[a];
+        const auto rvy      = (rhs ? batch.velocityY[b] : 0.f) - batch.velocityY[a];
+        const auto rvz      = (rhs ? batch.velocityZ[b] : 0.f) - batch.velocityZ[a];
+        const auto speed    = rvx * nx + rvy * ny + rvz * nz;
+
+        // The force pulling the first end towards the second, the second end gets the opposite.
+        const auto pull     = stiffness * (length - restLength) + damping * speed;
+
+        if (inRangeA)
+        {
+            const auto scale = pull * weight (batch, a);
+
+            batch.forceX[a] += nx * scale;
+            batch.forceY[a] += ny * scale;
+            batch.forceZ[a] += nz * scale;
+        }
+
+        if (inRangeB)
+        {
+            const auto scale = pull * weight (batch, b);
+
+            batch.forceX[b] -= nx * scale;
+            batch.forceY[b] -= ny * scale;
+            batch.forceZ[b] -= nz * scale;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#ifndef SPC_FORCE_FIELDS_ASP_HPP
+#define SPC_FORCE_FIELDS_ASP_HPP
+
+
+// STL headers.
+#include <memory>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/AABB.hpp>
+#include <Physics/ForceGenerator.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// Accelerates every affected body equally regardless of its mass, e.g. extra gravity for a single layer. The
+    /// gravity of the PhysicsSystem is applied by the integrator and doesn't need one of these.
+    /// </summary>
+    class UniformGravity final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds mass * acceleration to every affected body. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            math::Vector3   acceleration    { 0.f, -9.81f, 0.f };   //!< The acceleration given to each body.
+    };
+
+
+    /// <summary>
+    /// Slows affected bodies in proportion to their speed. This is on top of the drag of each object, which only
+    /// applies to that object.
+    /// </summary>
+    class LinearDrag final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds -coefficient * velocity to every affected body. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            float   coefficient { 0.1f };   //!< The force per metre per second of velocity.
+    };
+
+
+    /// <summary>
+    /// Slows affected bodies in proportion to the square of their speed, like air resistance at speed.
+    /// </summary>
+    class QuadraticDrag final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds -coefficient * |velocity| * velocity to every affected body. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            float   coefficient { 0.01f };  //!< The force per square metre per second of velocity.
+    };
+
+
+    /// <summary>
+    /// A box of moving air which drags the bodies inside it towards its velocity. Bodies already moving with the wind
+    /// feel nothing.
+    /// </summary>
+    class WindVolume final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds coefficient * (wind - velocity) to every affected body whose centre is in the volume. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            AABB            volume      { AABB::infinite() };   //!< Where the wind blows, everywhere by default.
+            math::Vector3   wind        { 1.f, 0.f, 0.f };      //!< The velocity of the air.
+            float           coefficient { 1.f };                //!< The force per metre per second of relative velocity.
+    };
+
+
+    /// <summary>
+    /// Pulls affected bodies within a radius towards a point with an acceleration which falls off with the square of the
+    /// distance, so a negative strength gives a repeller.
+    /// </summary>
+    class PointAttractor final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds mass * strength / distance^2 towards the centre to every affected body in range. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            math::Vector3   centre      { 0.f, 0.f, 0.f };  //!< The world position bodies are pulled towards.
+            float           strength    { 10.f };           //!< The acceleration one metre from the centre.
+            float           radius      { 10.f };           //!< How far the attractor reaches.
+            float           minDistance { 0.5f };           //!< The distance is clamped to this so bodies at the centre aren't flung away.
+    };
+
+
+    /// <summary>
+    /// A damped spring between two objects, or between an object and a fixed point when there's no second object.
+    /// Objects are held weakly, the spring does nothing once either has been destroyed. Each end is only pushed when it
+    /// is simulated and on one of the layers of the spring, so a spring to a static object acts like an anchor.
+    /// </summary>
+    class Spring final : public ForceGenerator
+    {
+        public:
+
+            /// <summary> Adds the spring force to whichever ends are in the range. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            void apply (const ForceBatch& batch) const override;
+
+
+            /////////////////
+            // Public data //
+            /////////////////
+
+            std::weak_ptr<PhysicsObject>    first       { };                    //!< The object at the first end.
+            std::weak_ptr<PhysicsObject>    second      { };                    //!< The object at the second end, the anchor is used if this is empty.
+            math::Vector3                   anchor      { 0.f, 0.f, 0.f };      //!< The world position of the second end when there's no second object.
+            float                           restLength  { 1.f };                //!< The length at which the spring applies no force.
+            float                           stiffness   { 10.f };               //!< The force per metre of stretch.
+            float                           damping     { 0.5f };               //!< The force per metre per second the ends separate at.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,18 @@
+#include "ForceGenerator.hpp"
+
+
+// Personal headers.
+#include <Physics/PhysicsObject.hpp>
+
+
+namespace spc
+{
+    //////////////
+    // Internal //
+    //////////////
+
+    unsigned int ForceGenerator::bodyOf (const PhysicsObject& object)
+    {
+        return object.m_body;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#ifndef SPC_FORCE_GENERATOR_ASP_HPP
+#define SPC_FORCE_GENERATOR_ASP_HPP
+
+
+// STL headers.
+#include <cstdint>
+
+
+namespace spc
+{
+    // Forward declarations.
+    class PhysicsObject;
+
+
+    /// <summary>
+    /// A contiguous range of bodies handed to each ForceGenerator. Every array is indexed by body, not by the offset into
+    /// the range, so generators which link bodies can read the state of bodies outside of it. Forces may only be written
+    /// for bodies inside the range as the other ranges are being processed at the same time.
+    /// </summary>
+    struct ForceBatch final
+    {
+        unsigned int            first       { 0 };          //!< The index of the first body in the range.
+        unsigned int            last        { 0 };          //!< One past the index of the last body in the range.
+        const float*            positionX   { nullptr };    //!< The position of each body on the X axis.
+        const float*            positionY   { nullptr };    //!< The position of each body on the Y axis.
+        const float*            positionZ   { nullptr };    //!< The position of each body on the Z axis.
+        const float*            velocityX   { nullptr };    //!< The velocity of each body on the X axis.
+        const float*            velocityY   { nullptr };    //!< The velocity of each body on the Y axis.
+        const float*            velocityZ   { nullptr };    //!< The velocity of each body on the Z axis.
+        const float*            inverseMass { nullptr };    //!< The reciprocal of the mass of each body.
+        const float*            motion      { nullptr };    //!< 1 for each body being integrated this step, 0 otherwise.
+        const std::uint32_t*    layers      { nullptr };    //!< The layer mask of each body.
+        float*                  forceX      { nullptr };    //!< The force accumulated for each body on the X axis.
+        float*                  forceY      { nullptr };    //!< The force accumulated for each body on the Y axis.
+        float*                  forceZ      { nullptr };    //!< The force accumulated for each body on the Z axis.
+    };
+
+
+    /// <summary>
+    /// A field which adds force to bodies, registered with PhysicsSystem::addForceGenerator. Generators are evaluated
+    /// in the order they were added, once per step and before integration, and each one processes a whole range of
+    /// bodies at a time so the loop can be vectorised. A generator only affects simulated bodies whose layer mask
+    /// shares a bit with its own.
+    /// </summary>
+    class ForceGenerator
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ForceGenerator()                                        = default;
+            virtual ~ForceGenerator()                               = default;
+
+            ForceGenerator (const ForceGenerator& copy)             = default;
+            ForceGenerator& operator= (const ForceGenerator& copy)  = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets the layers of bodies which the generator affects. </summary>
+            /// <returns> The layer mask, every layer by default. </returns>
+            std::uint32_t getLayers() const                 { return m_layers; }
+
+            /// <summary> Sets the layers of bodies which the generator affects. </summary>
+            /// <param name="layers"> The new layer mask, a body is affected when it shares any bit with it. </param>
+            void setLayers (const std::uint32_t layers)     { m_layers = layers; }
+
+            /// <summary> Adds the force of the field to every affected body in the range. </summary>
+            /// <param name="batch"> The bodies to process. </param>
+            virtual void apply (const ForceBatch& batch) const = 0;
+
+        protected:
+
+            //////////////
+            // Internal //
+            //////////////
+
+            /// <summary> Calculates how much of the force of the field a body receives. </summary>
+            /// <param name="batch"> The bodies being processed. </param>
+            /// <param name="body"> The index of the body. </param>
+            /// <returns> 1 if the body is simulated and on one of the layers of the generator, 0 otherwise. </returns>
+            float weight (const ForceBatch& batch, const unsigned int body) const
+            {
+                return (batch.layers[body] & m_layers) != 0 ? batch.motion[body] : 0.f;
+            }
+
+            /// <summary> Finds the body of an object so generators can refer to specific objects. </summary>
+            /// <param name="object"> The object to find. </param>
+            /// <returns> The index of the body of the object in the BodyStore of its system. </returns>
+            static unsigned int bodyOf (const PhysicsObject& object);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::uint32_t   m_layers    { ~0U };    //!< The layers of bodies which the generator affects.
+    };
+}
+
+#endif
\ No newline at end of file
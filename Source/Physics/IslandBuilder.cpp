@@ -0,0 +1,139 @@
+#include "IslandBuilder.hpp"
+
+
+// STL headers.
+#include <cassert>
+#include <limits>
+#include <utility>
+
+
+namespace spc
+{
+    // The island of a representative which hasn't been given one yet.
+    static const auto unassigned = std::numeric_limits<unsigned int>::max();
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    IslandBuilder::IslandBuilder (IslandBuilder&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    IslandBuilder& IslandBuilder::operator= (IslandBuilder&& move)
+    {
+        if (this != &move)
+        {
+            m_parents       = std::move (move.m_parents);
+            m_pairIsland    = std::move (move.m_pairIsland);
+            m_rootIsland    = std::move (move.m_rootIsland);
+            m_islandStart   = std::move (move.m_islandStart);
+            m_islandPairs   = std::move (move.m_islandPairs);
+
+            move.m_islandStart.assign (1, 0);
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void IslandBuilder::build (const unsigned int objectCount, const std::vector<BroadphasePair>& pairs, const std::function<bool (unsigned int)>& isStatic)
+    {
+        // Every object starts in its own set.
+        m_parents.resize (objectCount);
+
+        for (auto i = 0U; i < objectCount; ++i)
+        {
+            m_parents[i] = i;
+        }
+
+        // Join the sets of moving objects which could touch.
+        for (const auto& pair : pairs)
+        {
+            if (!isStatic (pair.lhs) && !isStatic (pair.rhs))
+            {
+                unite (pair.lhs, pair.rhs);
+            }
+        }
+
+        // Number the islands in the order their first pair appears.
+        const auto pairCount = static_cast<unsigned int> (pairs.size());
+
+        m_rootIsland.assign (objectCount, unassigned);
+        m_pairIsland.resize (pairCount);
+        m_islandStart.assign (1, 0);
+
+        for (auto i = 0U; i < pairCount; ++i)
+        {
+            // Pre-condition: Static pairs are never found.
+            assert (!isStatic (pairs[i].lhs) || !isStatic (pairs[i].rhs));
+
+            const auto object = isStatic (pairs[i].lhs) ? pairs[i].rhs : pairs[i].lhs;
+            auto& island      = m_rootIsland[find (object)];
+
+            if (island == unassigned)
+            {
+                island = static_cast<unsigned int> (m_islandStart.size()) - 1;
+                m_islandStart.push_back (0);
+            }
+
+            m_pairIsland[i] = island;
+            ++m_islandStart[island + 1];
+        }
+
+        // Turn the counts into offsets and scatter the pairs, this keeps them in their original order.
+        for (auto i = 1U; i < m_islandStart.size(); ++i)
+        {
+            m_islandStart[i] += m_islandStart[i - 1];
+        }
+
+        m_islandPairs.resize (pairCount);
+
+        auto cursors = std::vector<unsigned int> (m_islandStart.begin(), m_islandStart.end() - 1);
+
+        for (auto i = 0U; i < pairCount; ++i)
+        {
+            m_islandPairs[cursors[m_pairIsland[i]]++] = i;
+        }
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    unsigned int IslandBuilder::find (unsigned int object)
+    {
+        while (m_parents[object] != object)
+        {
+            m_parents[object] = m_parents[m_parents[object]];
+            object            = m_parents[object];
+        }
+
+        return object;
+    }
+
+
+    void IslandBuilder::unite (const unsigned int lhs, const unsigned int rhs)
+    {
+        const auto lhsRoot = find (lhs);
+        const auto rhsRoot = find (rhs);
+
+        if (lhsRoot < rhsRoot)
+        {
+            m_parents[rhsRoot] = lhsRoot;
+        }
+
+        else if (rhsRoot < lhsRoot)
+        {
+            m_parents[lhsRoot] = rhsRoot;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef SPC_ISLAND_BUILDER_ASP_HPP
+#define SPC_ISLAND_BUILDER_ASP_HPP
+
+
+// STL headers.
+#include <functional>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Broadphase.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// Groups broadphase pairs into islands of objects which could affect each other this tick, using union-find.
+    /// Static objects are never modified by a collision so they don't join islands together, a floor touched by many
+    /// objects doesn't force them all into one island. Islands can therefore be resolved independently of each other.
+    /// The order of islands, and of the pairs within them, depends only on the order of the given pairs.
+    /// </summary>
+    class IslandBuilder final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            IslandBuilder()                                         = default;
+
+            IslandBuilder (IslandBuilder&& move);
+            IslandBuilder& operator= (IslandBuilder&& move);
+
+            IslandBuilder (const IslandBuilder& copy)               = default;
+            IslandBuilder& operator= (const IslandBuilder& copy)    = default;
+            ~IslandBuilder()                                        = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Splits the given pairs into islands. </summary>
+            /// <param name="objectCount"> How many objects the pairs index into. </param>
+            /// <param name="pairs"> The pairs which could be colliding, at least one object in each must not be static. </param>
+            /// <param name="isStatic"> Determines whether the object at the given index is static. </param>
+            void build (const unsigned int objectCount, const std::vector<BroadphasePair>& pairs, const std::function<bool (unsigned int)>& isStatic);
+
+            /// <summary> Gets how many islands were found by the last build. </summary>
+            /// <returns> The number of islands. </returns>
+            unsigned int getIslandCount() const                                     { return static_cast<unsigned int> (m_islandStart.size()) - 1; }
+
+            /// <summary> Gets the first pair index of an island, the indices refer to the pairs given to build. </summary>
+            /// <param name="island"> The island to obtain the pairs of. </param>
+            /// <returns> A pointer to the first pair index. </returns>
+            const unsigned int* pairsBegin (const unsigned int island) const        { return m_islandPairs.data() + m_islandStart[island]; }
+
+            /// <summary> Gets the end of the pair indices of an island. </summary>
+            /// <param name="island"> The island to obtain the pairs of. </param>
+            /// <returns> A pointer to one past the last pair index. </returns>
+            const unsigned int* pairsEnd (const unsigned int island) const          { return m_islandPairs.data() + m_islandStart[island + 1]; }
+
+        private:
+
+            /// <summary> Finds the representative of the set containing the given object, halving the path as it goes. </summary>
+            /// <param name="object"> The index of the object. </param>
+            /// <returns> The index of the representative. </returns>
+            unsigned int find (unsigned int object);
+
+            /// <summary> Merges the sets containing two objects, the lowest index becomes the representative. </summary>
+            /// <param name="lhs"> The first object. </param>
+            /// <param name="rhs"> The second object. </param>
+            void unite (const unsigned int lhs, const unsigned int rhs);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<unsigned int>   m_parents       { };    //!< The parent of each object in the union-find forest.
+            std::vector<unsigned int>   m_pairIsland    { };    //!< The island each pair was assigned to.
+            std::vector<unsigned int>   m_rootIsland    { };    //!< The island of each representative, or unassigned.
+            std::vector<unsigned int>   m_islandStart   { 0 };  //!< Where the pairs of each island start in m_islandPairs, with an extra end value.
+            std::vector<unsigned int>   m_islandPairs   { };    //!< The pair indices of every island, grouped by island.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "ObjectRegistry.hpp"
+
+
+// STL headers.
+#include <cassert>
+#include <utility>
+
+
+namespace spc
+{
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    ObjectRegistry::ObjectRegistry (ObjectRegistry&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    ObjectRegistry& ObjectRegistry::operator= (ObjectRegistry&& move)
+    {
+        if (this != &move)
+        {
+            m_slots     = std::move (move.m_slots);
+            m_free      = std::move (move.m_free);
+            m_objects   = std::move (move.m_objects);
+            m_owners    = std::move (move.m_owners);
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void ObjectRegistry::reserve (const unsigned int count)
+    {
+        m_slots.reserve (count);
+        m_objects.reserve (count);
+        m_owners.reserve (count);
+    }
+
+
+    ObjectHandle ObjectRegistry::add (const std::shared_ptr<PhysicsObject>& object)
+    {
+        // Pre-condition: We have an object.
+        assert (object);
+
+        // Reuse a removed slot if possible, its generation has already moved on.
+        auto slot = static_cast<unsigned int> (m_slots.size());
+
+        if (m_free.empty())
+        {
+            m_slots.emplace_back();
+        }
+
+        else
+        {
+            slot = m_free.back();
+            m_free.pop_back();
+        }
+
+        m_slots[slot].dense = static_cast<unsigned int> (m_objects.size());
+        m_objects.push_back (object);
+        m_owners.push_back (slot);
+
+        ObjectHandle handle { };
+        handle.slot       = slot;
+        handle.generation = m_slots[slot].generation;
+
+        return handle;
+    }
+
+
+    void ObjectRegistry::remove (const ObjectHandle handle)
+    {
+        if (!isValid (handle))
+        {
+            return;
+        }
+
+        // Move the last object into the gap so the list stays packed.
+        auto& slot      = m_slots[handle.slot];
+        const auto last = static_cast<unsigned int> (m_objects.size()) - 1;
+
+        if (slot.dense != last)
+        {
+            m_objects[slot.dense]           = std::move (m_objects[last]);
+            m_owners[slot.dense]            = m_owners[last];
+            m_slots[m_owners[last]].dense   = slot.dense;
+        }
+
+        m_objects.pop_back();
+        m_owners.pop_back();
+
+        // Zero is never a valid generation, so it's skipped if the generation wraps around.
+        if (++slot.generation == 0)
+        {
+            slot.generation = 1;
+        }
+
+        m_free.push_back (handle.slot);
+    }
+
+
+    bool ObjectRegistry::isValid (const ObjectHandle handle) const
+    {
+        return handle.slot < m_slots.size() && m_slots[handle.slot].generation == handle.generation;
+    }
+
+
+    std::shared_ptr<PhysicsObject> ObjectRegistry::lock (const ObjectHandle handle) const
+    {
+        return isValid (handle) ? m_objects[m_slots[handle.slot].dense].lock() : nullptr;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef SPC_OBJECT_REGISTRY_ASP_HPP
+#define SPC_OBJECT_REGISTRY_ASP_HPP
+
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+namespace spc
+{
+    // Forward declarations.
+    class PhysicsObject;
+
+
+    /// <summary>
+    /// Refers to an object in an ObjectRegistry. The generation of the slot is increased whenever its object is removed,
+    /// so handles to removed objects are detected even once the slot has been reused.
+    /// </summary>
+    struct ObjectHandle final
+    {
+        unsigned int slot       { 0 };  //!< The index of the slot in the registry.
+        unsigned int generation { 0 };  //!< The generation of the slot when the handle was made, zero is never valid.
+    };
+
+
+    /// <summary>
+    /// A generational index table of every object in a PhysicsSystem. Objects are stored densely so they can be iterated
+    /// without skipping dead entries, and each slot records where its object is in the dense list so objects can be
+    /// added, removed and looked up in constant time. Objects remove themselves as they're destroyed.
+    /// </summary>
+    class ObjectRegistry final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ObjectRegistry()                                        = default;
+
+            ObjectRegistry (ObjectRegistry&& move);
+            ObjectRegistry& operator= (ObjectRegistry&& move);
+
+            ObjectRegistry (const ObjectRegistry& copy)             = default;
+            ObjectRegistry& operator= (const ObjectRegistry& copy)  = default;
+            ~ObjectRegistry()                                       = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets how many objects are registered. </summary>
+            /// <returns> The number of objects. </returns>
+            unsigned int size() const                                       { return static_cast<unsigned int> (m_objects.size()); }
+
+            /// <summary> Gets every registered object, removing an object moves the last object into its place. </summary>
+            /// <returns> The dense list of objects. </returns>
+            const std::vector<std::weak_ptr<PhysicsObject>>& objects() const { return m_objects; }
+
+            /// <summary> Reserves enough memory for the given number of objects. </summary>
+            /// <param name="count"> How many objects to reserve. </param>
+            void reserve (const unsigned int count);
+
+            /// <summary> Registers an object, reusing the slot of a removed object if there is one. </summary>
+            /// <param name="object"> The object to register. </param>
+            /// <returns> A handle which stays valid until the object is removed. </returns>
+            ObjectHandle add (const std::shared_ptr<PhysicsObject>& object);
+
+            /// <summary> Removes an object, invalidating every handle to it. Invalid handles are ignored. </summary>
+            /// <param name="handle"> The handle of the object to remove. </param>
+            void remove (const ObjectHandle handle);
+
+            /// <summary> Checks whether a handle refers to an object which hasn't been removed. </summary>
+            /// <param name="handle"> The handle to check. </param>
+            /// <returns> Whether the handle is valid. </returns>
+            bool isValid (const ObjectHandle handle) const;
+
+            /// <summary> Obtains the object a handle refers to. </summary>
+            /// <param name="handle"> The handle of the object. </param>
+            /// <returns> The object, or nullptr if the handle isn't valid. </returns>
+            std::shared_ptr<PhysicsObject> lock (const ObjectHandle handle) const;
+
+        private:
+
+            /// <summary>
+            /// Where an object is stored and which generation of handle refers to it.
+            /// </summary>
+            struct Slot final
+            {
+                unsigned int    generation  { 1 };  //!< Handles with any other generation are invalid.
+                unsigned int    dense       { 0 };  //!< The index of the object in m_objects.
+            };
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<Slot>                           m_slots     { };    //!< Every slot which has been used, valid or not.
+            std::vector<unsigned int>                   m_free      { };    //!< Slots which can be reused.
+            std::vector<std::weak_ptr<PhysicsObject>>   m_objects   { };    //!< Every registered object, packed together.
+            std::vector<unsigned int>                   m_owners    { };    //!< The slot of each object in m_objects.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,346 @@
+#include "ParticleEmitter.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+
+// Personal headers.
+#include <Maths/BatchEulerIntegrator.hpp>
+#include <Maths/BatchRK4Integrator.hpp>
+
+
+namespace spc
+{
+    ///////////////////////
+    // ParticleObstacles //
+    ///////////////////////
+
+    void ParticleObstacles::clear()
+    {
+        planeNormals.clear();
+        planeOffsets.clear();
+        sphereCentres.clear();
+        sphereRadii.clear();
+    }
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    ParticleEmitter::ParticleEmitter()
+        : ParticleEmitter (Settings())
+    {
+    }
+
+
+    ParticleEmitter::ParticleEmitter (const Settings& settings)
+        : m_settings (settings), m_random (settings.seed)
+    {
+        // An emitter which can't hold anything could never replace its oldest particle.
+        m_settings.capacity = std::max (m_settings.capacity, 1U);
+        m_settings.maxSpeed = std::max (m_settings.maxSpeed, m_settings.minSpeed);
+        m_settings.variance = std::min (std::max (m_settings.variance, 0.f), 1.f);
+
+        const auto capacity = m_settings.capacity;
+
+        m_positionX.resize (capacity);
+        m_positionY.resize (capacity);
+        m_positionZ.resize (capacity);
+        m_velocityX.resize (capacity);
+        m_velocityY.resize (capacity);
+        m_velocityZ.resize (capacity);
+        m_remaining.resize (capacity);
+        m_older.resize (capacity);
+        m_younger.resize (capacity);
+
+        m_zeros.resize (capacity, 0.f);
+        m_ones.resize (capacity, 1.f);
+        m_drag.resize (capacity, m_settings.drag);
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    math::Vector3 ParticleEmitter::position (const unsigned int index) const
+    {
+        // Pre-condition: The particle is alive.
+        assert (index < m_count);
+
+        return { m_positionX[index], m_positionY[index], m_positionZ[index] };
+    }
+
+
+    unsigned int ParticleEmitter::emit (const math::Vector3& origin, const unsigned int count)
+    {
+        std::uniform_real_distribution<float> lean      (-m_settings.spread, m_settings.spread);
+        std::uniform_real_distribution<float> rise      (1.f - m_settings.spread, 1.f);
+        std::uniform_real_distribution<float> speed     (m_settings.minSpeed, m_settings.maxSpeed);
+        std::uniform_real_distribution<float> lifetime  (m_settings.lifetime * (1.f - m_settings.variance),
+                                                         m_settings.lifetime * (1.f + m_settings.variance));
+
+        for (auto n = 0U; n < count; ++n)
+        {
+            const auto i = spawn();
+
+            if (i == nullIndex)
+            {
+                return n;
+            }
+
+            // Directions are picked in a box above the origin and then normalised, falling back to straight up.
+            auto direction      = math::Vector3 (lean (m_random), rise (m_random), lean (m_random));
+            const auto length   = math::length (direction);
+            direction           = length > 1e-4f ? direction / length : math::Vector3 (0.f, 1.f, 0.f);
+
+            const auto velocity = direction * speed (m_random);
+
+            m_positionX[i]  = origin.x;
+            m_positionY[i]  = origin.y;
+            m_positionZ[i]  = origin.z;
+            m_velocityX[i]  = velocity.x;
+            m_velocityY[i]  = velocity.y;
+            m_velocityZ[i]  = velocity.z;
+            m_remaining[i]  = lifetime (m_random);
+        }
+
+        return count;
+    }
+
+
+    void ParticleEmitter::update (const float deltaTime, const math::Vector3& gravity, const ParticleObstacles& obstacles)
+    {
+        retire (deltaTime);
+
+        if (m_count > 0)
+        {
+            integrate (deltaTime, gravity);
+            collide (obstacles);
+        }
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    void ParticleEmitter::retire (const float deltaTime)
+    {
+        for (auto i = 0U; i < m_count; ++i)
+        {
+            m_remaining[i] -= deltaTime;
+        }
+
+        // A killed particle is replaced by the last one, which needs checking too, so the index only moves on when the
+        // particle survives.
+        for (auto i = 0U; i < m_count;)
+        {
+            if (m_remaining[i] <= 0.f)
+            {
+                kill (i);
+            }
+
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+
+    unsigned int ParticleEmitter::spawn()
+    {
+        if (m_count == m_settings.capacity)
+        {
+            if (m_settings.overflow == Overflow::Refuse)
+            {
+                return nullIndex;
+            }
+
+            kill (m_oldest);
+        }
+
+        // The new particle goes on the young end of the spawn order.
+        const auto i    = m_count++;
+        m_older[i]      = m_youngest;
+        m_younger[i]    = nullIndex;
+
+        (m_youngest != nullIndex ? m_younger[m_youngest] : m_oldest) = i;
+        m_youngest = i;
+
+        return i;
+    }
+
+
+    void ParticleEmitter::kill (const unsigned int index)
+    {
+        // Pre-condition: The particle is alive.
+        assert (index < m_count);
+
+        // Take the particle out of the spawn order.
+        const auto older    = m_older[index];
+        const auto younger  = m_younger[index];
+
+        (older != nullIndex ? m_younger[older] : m_oldest)      = younger;
+        (younger != nullIndex ? m_older[younger] : m_youngest)  = older;
+
+        // Fill the gap with the last particle so the live particles stay packed, its neighbours must follow it.
+        const auto last = --m_count;
+
+        if (index != last)
+        {
+            m_positionX[index]  = m_positionX[last];
+            m_positionY[index]  = m_positionY[last];
+            m_positionZ[index]  = m_positionZ[last];
+            m_velocityX[index]  = m_velocityX[last];
+            m_velocityY[index]  = m_velocityY[last];
+            m_velocityZ[index]  = m_velocityZ[last];
+            m_remaining[index]  = m_remaining[last];
+            m_older[index]      = m_older[last];
+            m_younger[index]    = m_younger[last];
+
+            (m_older[index] != nullIndex ? m_younger[m_older[index]] : m_oldest)        = index;
+            (m_younger[index] != nullIndex ? m_older[m_younger[index]] : m_youngest)    = index;
+        }
+    }
+
+
+    void ParticleEmitter::integrate (const float deltaTime, const math::Vector3& gravity)
+    {
+        BatchRK4Integrator::Bodies bodies { };
+        bodies.inverseMass  = m_ones.data();
+        bodies.drag         = m_drag.data();
+        bodies.motion       = m_ones.data();
+        bodies.count        = m_count;
+
+        BatchRK4Integrator::Axis axes[3] { };
+        axes[0].position    = m_positionX.data();
+        axes[0].velocity    = m_velocityX.data();
+        axes[0].gravity     = gravity.x;
+        axes[1].position    = m_positionY.data();
+        axes[1].velocity    = m_velocityY.data();
+        axes[1].gravity     = gravity.y;
+        axes[2].position    = m_positionZ.data();
+        axes[2].velocity    = m_velocityZ.data();
+        axes[2].gravity     = gravity.z;
+
+        for (auto& axis : axes)
+        {
+            axis.force = m_zeros.data();
+
+            if (m_settings.integrator == Integrator::RK4)
+            {
+                BatchRK4Integrator::integrate (axis, bodies, deltaTime);
+            }
+
+            else
+            {
+                BatchEulerIntegrator::integrate (axis, bodies, deltaTime);
+            }
+        }
+    }
+
+
+    void ParticleEmitter::collide (const ParticleObstacles& obstacles)
+    {
+        const auto count    = m_count;
+        const auto radius   = m_settings.radius;
+        const auto bounce   = 1.f + m_settings.restitution;
+
+        auto* const px      = m_positionX.data();
+        auto* const py      = m_positionY.data();
+        auto* const pz      = m_positionZ.data();
+        auto* const vx      = m_velocityX.data();
+        auto* const vy      = m_velocityY.data();
+        auto* const vz      = m_velocityZ.data();
+
+        // Planes are infinite so every particle is tested. The loop has no branches so it can be vectorised.
+        for (auto p = 0U; p < obstacles.planeNormals.size(); ++p)
+        {
+            const auto normal = obstacles.planeNormals[p];
+            const auto offset = obstacles.planeOffsets[p] + radius;
+
+            for (auto i = 0U; i < count; ++i)
+            {
+                const auto distance = px[i] * normal.x + py[i] * normal.y + pz[i] * normal.z - offset;
+                const auto depth    = std::min (distance, 0.f);
+                const auto speed    = vx[i] * normal.x + vy[i] * normal.y + vz[i] * normal.z;
+                const auto impulse  = depth < 0.f ? std::min (speed, 0.f) * bounce : 0.f;
+
+                px[i] -= normal.x * depth;
+                py[i] -= normal.y * depth;
+                pz[i] -= normal.z * depth;
+                vx[i] -= normal.x * impulse;
+                vy[i] -= normal.y * impulse;
+                vz[i] -= normal.z * impulse;
+            }
+        }
+
+        if (obstacles.sphereCentres.empty())
+        {
+            return;
+        }
+
+        // Spheres are usually far from most of the debris, so only those overlapping the particles are tested.
+        auto min = math::Vector3 (std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        auto max = -min;
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            min.x = std::min (min.x, px[i]);
+            min.y = std::min (min.y, py[i]);
+            min.z = std::min (min.z, pz[i]);
+            max.x = std::max (max.x, px[i]);
+            max.y = std::max (max.y, py[i]);
+            max.z = std::max (max.z, pz[i]);
+        }
+
+        for (auto s = 0U; s < obstacles.sphereCentres.size(); ++s)
+        {
+            const auto centre   = obstacles.sphereCentres[s];
+            const auto reach    = obstacles.sphereRadii[s] + radius;
+
+            if (centre.x + reach < min.x || centre.x - reach > max.x ||
+                centre.y + reach < min.y || centre.y - reach > max.y ||
+                centre.z + reach < min.z || centre.z - reach > max.z)
+            {
+                continue;
+            }
+
+            for (auto i = 0U; i < count; ++i)
+            {
+                const auto dx       = px[i] - centre.x;
+                const auto dy       = py[i] - centre.y;
+                const auto dz       = pz[i] - centre.z;
+                const auto sqrDist  = dx * dx + dy * dy + dz * dz;
+
+                // A particle exactly at the centre has no direction to be pushed in, the next step will separate it.
+                if (sqrDist >= reach * reach || sqrDist == 0.f)
+                {
+                    continue;
+                }
+
+                const auto distance = std::sqrt (sqrDist);
+                const auto nx       = dx / distance;
+                const auto ny       = dy / distance;
+                const auto nz       = dz / distance;
+                const auto depth    = distance - reach;
+                const auto speed    = vx[i] * nx + vy[i] * ny + vz[i] * nz;
+                const auto impulse  = std::min (speed, 0.f) * bounce;
+
+                px[i] -= nx * depth;
+                py[i] -= ny * depth;
+                pz[i] -= nz * depth;
+                vx[i] -= nx * impulse;
+                vy[i] -= ny * impulse;
+                vz[i] -= nz * impulse;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#ifndef SPC_PARTICLE_EMITTER_ASP_HPP
+#define SPC_PARTICLE_EMITTER_ASP_HPP
+
+
+// STL headers.
+#include <random>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// The shapes particles collide with, gathered from the scene once per step by the ParticleSystem and shared by
+    /// every emitter. Each shape is stored as separate arrays so emitters can test them without touching any objects.
+    /// </summary>
+    struct ParticleObstacles final
+    {
+        std::vector<math::Vector3>  planeNormals    { };    //!< The unit normal of each plane.
+        std::vector<float>          planeOffsets    { };    //!< The distance of each plane from the origin along its normal.
+        std::vector<math::Vector3>  sphereCentres   { };    //!< The world position of each sphere.
+        std::vector<float>          sphereRadii     { };    //!< The radius of each sphere.
+
+        /// <summary> Removes every shape whilst keeping the memory for the next step. </summary>
+        void clear();
+    };
+
+
+    /// <summary>
+    /// A burst of lightweight particles, e.g. the debris of an explosion. Particles are points with a velocity and an
+    /// age, they aren't PhysicsObjects and never affect the rest of the scene, they only collide with it. Each axis is
+    /// stored as its own array and integrated with the batch integrators. Storage is a fixed capacity pool allocated
+    /// once on construction, live particles are packed at the front so a spawn is a write to the end and a death moves
+    /// the last particle into the gap. A list threaded through the pool in spawn order lets the oldest particle be found
+    /// without searching, so a full emitter can replace it in constant time.
+    /// </summary>
+    class ParticleEmitter final
+    {
+        public:
+
+            /// <summary>
+            /// The numerical integration method used to move particles.
+            /// </summary>
+            enum class Integrator : int
+            {
+                Euler   = 0,    //!< Explicit Euler, cheap and plenty for short lived debris.
+                RK4     = 1     //!< The Runge-Kutta fourth-order method, for when the drag is high.
+            };
+
+
+            /// <summary>
+            /// What happens when particles are emitted by a full emitter.
+            /// </summary>
+            enum class Overflow : int
+            {
+                DropOldest  = 0,    //!< The oldest live particle is killed to make room.
+                Refuse      = 1     //!< The new particle isn't emitted.
+            };
+
+
+            /// <summary>
+            /// How an emitter launches its particles and how they behave afterwards.
+            /// </summary>
+            struct Settings final
+            {
+                unsigned int    capacity    { 1024 };                       //!< The most particles alive at once.
+                Overflow        overflow    { Overflow::DropOldest };       //!< What happens when the emitter is full.
+                float           lifetime    { 2.f };                        //!< How many seconds each particle lives for on average.
+                float           variance    { 0.25f };                      //!< How far each lifetime may randomly differ from the average, as a fraction of it.
+                float           minSpeed    { 2.f };                        //!< The slowest a particle is launched in metres per second.
+                float           maxSpeed    { 6.f };                        //!< The fastest a particle is launched in metres per second.
+                float           spread      { 0.75f };                      //!< 0 launches straight up, 1 launches anywhere in the upper hemisphere.
+                float           drag        { 0.25f };                      //!< The linear drag co-efficient of each particle.
+                float           radius      { 0.02f };                      //!< How far particles are kept from the surface of obstacles.
+                float           restitution { 0.4f };                       //!< How much speed particles keep when they bounce, from 0 to 1.
+                Integrator      integrator  { Integrator::Euler };          //!< How particles are moved.
+                unsigned int    seed        { 1 };                          //!< Seeds the launch directions, speeds and lifetimes.
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ParticleEmitter();
+            explicit ParticleEmitter (const Settings& settings);
+
+            // Emitters are only simulated through the shared_ptr given by ParticleSystem::createEmitter.
+            ParticleEmitter (ParticleEmitter&& move)                    = delete;
+            ParticleEmitter& operator= (ParticleEmitter&& move)         = delete;
+
+            ParticleEmitter (const ParticleEmitter& copy)               = delete;
+            ParticleEmitter& operator= (const ParticleEmitter& copy)    = delete;
+            ~ParticleEmitter()                                          = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets the settings the emitter was created with. </summary>
+            /// <returns> The settings, the capacity is always at least 1. </returns>
+            const Settings& getSettings() const     { return m_settings; }
+
+            /// <summary> Gets how many particles are alive. </summary>
+            /// <returns> The number of live particles. </returns>
+            unsigned int size() const               { return m_count; }
+
+            /// <summary> Gets the most particles which can be alive at once. </summary>
+            /// <returns> The capacity of the emitter. </returns>
+            unsigned int capacity() const           { return m_settings.capacity; }
+
+            /// <summary> Checks whether every particle has died. </summary>
+            /// <returns> Whether no particles are alive. </returns>
+            bool isEmpty() const                    { return m_count == 0; }
+
+            /// <summary> Gets the position of a live particle, particles are in no particular order. </summary>
+            /// <param name="index"> A value from 0 to size() - 1. </param>
+            /// <returns> The world position of the particle. </returns>
+            math::Vector3 position (const unsigned int index) const;
+
+            /// <summary>
+            /// Launches particles from a point using the settings of the emitter. Each particle takes constant time and
+            /// no memory is allocated. A full emitter follows its overflow policy.
+            /// </summary>
+            /// <param name="origin"> Where the particles start. </param>
+            /// <param name="count"> How many particles to launch. </param>
+            /// <returns> How many particles were launched, fewer than requested if the emitter refused some. </returns>
+            unsigned int emit (const math::Vector3& origin, const unsigned int count);
+
+            /// <summary> Ages, moves and collides every live particle, removing any which have reached their lifetime. </summary>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            /// <param name="gravity"> The acceleration applied to every particle. </param>
+            /// <param name="obstacles"> The shapes which particles bounce off. </param>
+            void update (const float deltaTime, const math::Vector3& gravity, const ParticleObstacles& obstacles);
+
+        private:
+
+            //////////////
+            // Internal //
+            //////////////
+
+            /// <summary> Ages every live particle and kills those which have reached their lifetime. </summary>
+            /// <param name="deltaTime"> How many seconds have passed. </param>
+            void retire (const float deltaTime);
+
+            /// <summary> Claims the slot at the end of the pool for a new particle and makes it the youngest. </summary>
+            /// <returns> The index of the slot, or nullIndex if the emitter is full and refuses new particles. </returns>
+            unsigned int spawn();
+
+            /// <summary> Kills a particle by moving the last live particle into its slot. </summary>
+            /// <param name="index"> The slot of the particle to kill. </param>
+            void kill (const unsigned int index);
+
+            /// <summary> Moves every live particle. </summary>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            /// <param name="gravity"> The acceleration applied to every particle. </param>
+            void integrate (const float deltaTime, const math::Vector3& gravity);
+
+            /// <summary>
+            /// Pushes every live particle out of every obstacle and reflects their velocity. Spheres which don't overlap
+            /// the bounds of the live particles are skipped.
+            /// </summary>
+            /// <param name="obstacles"> The shapes which particles bounce off. </param>
+            void collide (const ParticleObstacles& obstacles);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            static const unsigned int   nullIndex = ~0U;                //!< Marks either end of the spawn order list.
+
+            Settings                    m_settings  { };                //!< How particles are launched and behave.
+            std::minstd_rand            m_random    { };                //!< Picks the direction, speed and lifetime of each particle.
+            unsigned int                m_count     { 0 };              //!< How many particles are alive, they occupy the first slots.
+            unsigned int                m_oldest    { nullIndex };      //!< The slot of the oldest live particle.
+            unsigned int                m_youngest  { nullIndex };      //!< The slot of the youngest live particle.
+
+            std::vector<float>          m_positionX { };                //!< The X position of each particle.
+            std::vector<float>          m_positionY { };                //!< The Y position of each particle.
+            std::vector<float>          m_positionZ { };                //!< The Z position of each particle.
+            std::vector<float>          m_velocityX { };                //!< The X velocity of each particle.
+            std::vector<float>          m_velocityY { };                //!< The Y velocity of each particle.
+            std::vector<float>          m_velocityZ { };                //!< The Z velocity of each particle.
+            std::vector<float>          m_remaining { };                //!< How many seconds each particle has left to live.
+            std::vector<unsigned int>   m_older     { };                //!< The slot of the particle spawned before each one.
+            std::vector<unsigned int>   m_younger   { };                //!< The slot of the particle spawned after each one.
+
+            std::vector<float>          m_zeros     { };                //!< Particles have no force applied, given to the integrators as the force of every axis.
+            std::vector<float>          m_ones      { };                //!< Particles are massless and always move, given as the inverse mass and motion.
+            std::vector<float>          m_drag      { };                //!< The drag of every particle, which is the same for the whole emitter.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "ParticleSystem.hpp"
+
+
+// STL headers.
+#include <utility>
+
+
+// Personal headers.
+#include <Utility/Misc.hpp>
+
+
+namespace spc
+{
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    ParticleSystem::ParticleSystem (ParticleSystem&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    ParticleSystem& ParticleSystem::operator= (ParticleSystem&& move)
+    {
+        if (this != &move)
+        {
+            m_emitters  = std::move (move.m_emitters);
+            m_obstacles = std::move (move.m_obstacles);
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    unsigned int ParticleSystem::getParticleCount() const
+    {
+        auto count = 0U;
+
+        for (const auto& emitter : m_emitters)
+        {
+            count += emitter->size();
+        }
+
+        return count;
+    }
+
+
+    std::shared_ptr<ParticleEmitter> ParticleSystem::createEmitter (const ParticleEmitter::Settings& settings)
+    {
+        const auto emitter = std::make_shared<ParticleEmitter> (settings);
+        m_emitters.push_back (emitter);
+
+        return emitter;
+    }
+
+
+    void ParticleSystem::update (const float deltaTime, const math::Vector3& gravity, const std::vector<Collider>& colliders, util::ThreadPool& pool)
+    {
+        // Emitters nobody else holds can't be given any more particles, so they're finished once they're empty.
+        util::stableRemove (m_emitters, [] (const std::shared_ptr<ParticleEmitter>& emitter)
+        {
+            return emitter.use_count() == 1 && emitter->isEmpty();
+        });
+
+        if (m_emitters.empty())
+        {
+            return;
+        }
+
+        // Boxes are rare in the scene and expensive to test, so debris only bounces off planes and spheres.
+        m_obstacles.clear();
+
+        for (const auto& collider : colliders)
+        {
+            if (!collider.attached)
+            {
+                continue;
+            }
+
+            if (collider.type == PhysicsObject::Type::Plane)
+            {
+                m_obstacles.planeNormals.push_back (collider.normal);
+                m_obstacles.planeOffsets.push_back (collider.offset);
+            }
+
+            else if (collider.type == PhysicsObject::Type::Sphere)
+            {
+                m_obstacles.sphereCentres.push_back (collider.centre);
+                m_obstacles.sphereRadii.push_back (collider.radius);
+            }
+        }
+
+        pool.parallelFor (static_cast<unsigned int> (m_emitters.size()), [=] (const unsigned int i)
+        {
+            m_emitters[i]->update (deltaTime, gravity, m_obstacles);
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef SPC_PARTICLE_SYSTEM_ASP_HPP
+#define SPC_PARTICLE_SYSTEM_ASP_HPP
+
+
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/Collider.hpp>
+#include <Physics/ParticleEmitter.hpp>
+#include <Utility/ThreadPool.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// Simulates every ParticleEmitter in a scene apart from the PhysicsObjects, so thousands of particles cost a few
+    /// arrays rather than thousands of components. Owned and stepped by the PhysicsSystem, which gives it the colliders
+    /// of the scene each step. Emitters are independent of each other so they're updated in parallel. An emitter is
+    /// kept until it is both empty and no longer referenced outside of the system, so a burst can outlive whatever
+    /// triggered it.
+    /// </summary>
+    class ParticleSystem final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            ParticleSystem()                                        = default;
+
+            ParticleSystem (ParticleSystem&& move);
+            ParticleSystem& operator= (ParticleSystem&& move);
+
+            ParticleSystem (const ParticleSystem& copy)             = delete;
+            ParticleSystem& operator= (const ParticleSystem& copy)  = delete;
+            ~ParticleSystem()                                       = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets how many emitters are being simulated. </summary>
+            /// <returns> The number of emitters. </returns>
+            unsigned int getEmitterCount() const    { return static_cast<unsigned int> (m_emitters.size()); }
+
+            /// <summary> Counts the live particles of every emitter. </summary>
+            /// <returns> The total number of live particles. </returns>
+            unsigned int getParticleCount() const;
+
+            /// <summary> Creates an emitter and starts simulating it, all of its memory is allocated here. </summary>
+            /// <param name="settings"> How the emitter launches particles and how they behave. </param>
+            /// <returns> The new emitter. </returns>
+            std::shared_ptr<ParticleEmitter> createEmitter (const ParticleEmitter::Settings& settings);
+
+            /// <summary> Updates every emitter and stops simulating those which are empty and no longer referenced. </summary>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            /// <param name="gravity"> The acceleration applied to every particle. </param>
+            /// <param name="colliders"> The shapes in the scene, planes and spheres are used as obstacles. </param>
+            /// <param name="pool"> The threads to spread emitters across. </param>
+            void update (const float deltaTime, const math::Vector3& gravity, const std::vector<Collider>& colliders, util::ThreadPool& pool);
+
+        private:
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<std::shared_ptr<ParticleEmitter>>   m_emitters  { };    //!< Every emitter being simulated, in creation order.
+            ParticleObstacles                               m_obstacles { };    //!< The planes and spheres of the scene this step.
+    };
+}
+
+#endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 
 // STL headers.
-#include <utility>
+#include <cmath>
 
 
 // Engine headers.
@@ -11,57 +11,73 @@
 
 namespace spc
 {
-    //////////////////
-    // Constructors //
-    //////////////////
-
-    PhysicsBox::PhysicsBox (PhysicsBox&& move)
-    {
-        *this = std::move (move);
-    }
-
-
-    PhysicsBox& PhysicsBox::operator= (PhysicsBox&& move)
-    {
-        if (this != &move)
-        {
-            // Ensure parent data is moved.
-            PhysicsObject::operator= (std::move (move));
-        }
-
-        return *this;
-    }
-
-    
     ///////////////////////
     // Object properties //
     ///////////////////////
 
-    tyga::Vector3 PhysicsBox::U() const
+    math::Vector3 PhysicsBox::U() const
     {
         // Obtain the transform.
-        const auto transform = util::transformation (*this);
+        const auto transform = transformation();
 
         // Return the rotational vector for the X axis.
         return util::xRotation (transform);
     }
 
 
-    tyga::Vector3 PhysicsBox::V() const
+    math::Vector3 PhysicsBox::V() const
     {
         // Obtain the transform.
-        const auto transform = util::transformation (*this);
+        const auto transform = transformation();
 
         // Return the rotational vector for the Y axis.
         return util::yRotation (transform);
     }
 
-    tyga::Vector3 PhysicsBox::W() const
+    math::Vector3 PhysicsBox::W() const
     {
         // Obtain the transform.
-        const auto transform = util::transformation (*this);
+        const auto transform = transformation();
 
         // Return the rotational vector for the Z axis.
         return util::zRotation (transform);
     }
+
+
+    AABB PhysicsBox::bounds() const
+    {
+        // Obtain the transform once rather than for each axis.
+        const auto transform = transformation();
+        const auto u         = util::xRotation (transform),
+                   v         = util::yRotation (transform),
+                   w         = util::zRotation (transform);
+
+        // Each axis contributes half of its absolute length on each world axis.
+        const auto extents = math::Vector3 (std::abs (u.x) + std::abs (v.x) + std::abs (w.x),
+                                            std::abs (u.y) + std::abs (v.y) + std::abs (w.y),
+                                            std::abs (u.z) + std::abs (v.z) + std::abs (w.z)) * 0.5f;
+
+        return AABB::fromCentre (util::position (transform), extents);
+    }
+
+
+    PhysicsBox::Frame PhysicsBox::frame() const
+    {
+        const auto transform = transformation();
+        const auto rows      = std::array<math::Vector3, 3> { util::xRotation (transform), util::yRotation (transform), util::zRotation (transform) };
+        const auto fallbacks = std::array<math::Vector3, 3> { math::Vector3 (1.f, 0.f, 0.f), math::Vector3 (0.f, 1.f, 0.f), math::Vector3 (0.f, 0.f, 1.f) };
+
+        Frame frame { };
+        frame.centre = util::position (transform);
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            // A box scaled to nothing on an axis still needs a valid direction for that axis.
+            const auto length    = math::length (rows[i]);
+            frame.axes[i]        = length > 0.f ? rows[i] / length : fallbacks[i];
+            frame.halfExtents[i] = length * 0.5f;
+        }
+
+        return frame;
+    }
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 #define SPC_PHYSICS_BOX_ASP_HPP
 
 
+// STL headers.
+#include <array>
+
+
 // Engine headers.
 #include <Physics/PhysicsObject.hpp>
 
@@ -14,18 +18,30 @@ namespace spc
     class PhysicsBox final : public PhysicsObject
     {
         public:
+
+            /// <summary>
+            /// The world space shape of the box. The transformation is only fetched once to create it, so the narrowphase
+            /// can use it instead of calling U, V and W for every axis.
+            /// </summary>
+            struct Frame final
+            {
+                math::Vector3                   centre      { };    //!< The world position of the centre of the box.
+                std::array<math::Vector3, 3>    axes        { };    //!< The unit directions of U, V and W.
+                std::array<float, 3>            halfExtents { };    //!< Half the length of the box along each axis.
+            };
+
         
             /////////////////////////////////
             // Constructors and destructor //
             /////////////////////////////////
 
             PhysicsBox()                                    = default;
-            PhysicsBox (const PhysicsBox& copy)             = default;
-            PhysicsBox& operator= (const PhysicsBox& copy)  = default;
+            PhysicsBox (const PhysicsBox& copy)             = delete;
+            PhysicsBox& operator= (const PhysicsBox& copy)  = delete;
             ~PhysicsBox() override final                    = default;
         
-            PhysicsBox (PhysicsBox&& move);
-            PhysicsBox& operator= (PhysicsBox&& move);
+            PhysicsBox (PhysicsBox&& move)                  = delete;
+            PhysicsBox& operator= (PhysicsBox&& move)       = delete;
 
 
             ///////////////////////
@@ -36,17 +52,28 @@ namespace spc
             /// <returns> PhysicsObject::Type::Sphere. </returns>
             inline Type getType() const override final { return Type::Box; }
 
+            /// <summary> 
+            /// Calculates the box surrounding the collider. The collider is a unit cube scaled and rotated by the actors
+            /// transformation, matching the "cube" mesh.
+            /// </summary>
+            /// <returns> The world space bounds of the box. </returns>
+            AABB bounds() const override final;
+
+            /// <summary> Obtains the centre, axes and size of the box from a single fetch of the transformation. </summary>
+            /// <returns> The world space shape of the box. </returns>
+            Frame frame() const;
+
             /// <summary> Obtains a vector containing the rotation on the X axis of the box. </summary>
             /// <returns> A rotation vector. </returns>
-            tyga::Vector3 U() const;        
+            math::Vector3 U() const;        
 
             /// <summary> Obtains a vector containing the rotation on the Y axis of the box. </summary>
             /// <returns> A rotation vector. </returns>
-            tyga::Vector3 V() const;
+            math::Vector3 V() const;
         
             /// <summary> Obtains a vector containing the rotation on the Z axis of the box. </summary>
             /// <returns> A rotation vector. </returns>
-            tyga::Vector3 W() const;
+            math::Vector3 W() const;
     };
 }
 
@@ -2,60 +2,224 @@
 
 
 // STL headers.
-#include <utility>
+#include <cassert>
 
 
-// Engine headers.
-#include <Utility/Tyga.hpp>
+// Personal headers.
+#include <Physics/BodyStore.hpp>
+#include <Physics/PhysicsSystem.hpp>
 
 
 namespace spc
 {
-    //////////////////
-    // Constructors //
-    //////////////////
+    /////////////////////////////////
+    // Constructors and destructor //
+    /////////////////////////////////
 
-    PhysicsObject::PhysicsObject (PhysicsObject&& move)
+    PhysicsObject::~PhysicsObject()
     {
-        *this = std::move (move);
+        // The object is unregistered straight away but the system will remove the body upon the next compaction.
+        if (m_system)
+        {
+            m_system->m_registry.remove (m_handle);
+            store().kill (m_body);
+        }
+    }
+
+
+    ///////////////////////
+    // Object properties //
+    ///////////////////////
+
+    math::Vector3 PhysicsObject::position() const
+    {
+        return store().position (m_body);
+    }
+
+
+    math::Matrix4x4 PhysicsObject::transformation() const
+    {
+        // The bottom row of the transform contains the translation.
+        const auto& bodies = store();
+        auto transform     = bodies.transforms[m_body];
+
+        transform._30 = bodies.positionX[m_body];
+        transform._31 = bodies.positionY[m_body];
+        transform._32 = bodies.positionZ[m_body];
+
+        return transform;
+    }
+
+
+    math::Vector3 PhysicsObject::interpolatedPosition() const
+    {
+        const auto& bodies  = store();
+        const auto alpha    = m_system->getInterpolationAlpha();
+        const auto previous = bodies.previousPosition (m_body);
+
+        return previous + (bodies.position (m_body) - previous) * alpha;
     }
 
 
-    PhysicsObject& PhysicsObject::operator= (PhysicsObject&& move)
+    math::Matrix4x4 PhysicsObject::interpolatedTransformation() const
     {
-        if (this != &move)
+        const auto position = interpolatedPosition();
+        auto transform      = store().transforms[m_body];
+
+        transform._30 = position.x;
+        transform._31 = position.y;
+        transform._32 = position.z;
+
+        return transform;
+    }
+
+
+    void PhysicsObject::translate (const math::Vector3& translation)
+    {
+        auto& bodies = store();
+        bodies.setPosition (m_body, bodies.position (m_body) + translation);
+        wake();
+    }
+
+
+    math::Vector3 PhysicsObject::getVelocity() const
+    {
+        return store().velocity (m_body);
+    }
+
+
+    void PhysicsObject::setVelocity (const math::Vector3& velocity)
+    {
+        store().setVelocity (m_body, velocity);
+
+        if (velocity.x != 0.f || velocity.y != 0.f || velocity.z != 0.f)
         {
-            // Move thy data.
-            velocity    = std::move (velocity);
-            force       = std::move (force);
-            drag        = move.drag;
-            restitution = move.restitution;
-            isStatic    = move.isStatic;
-
-            m_mass      = move.m_mass;
-
-            // Reset primitives.
-            move.drag        = 0.f;
-            move.restitution = 0.f;
-            move.isStatic    = false;
-            move.m_mass      = 0.f;
+            wake();
         }
+    }
+
 
-        return *this;
+    math::Vector3 PhysicsObject::getForce() const
+    {
+        return store().force (m_body);
     }
 
 
-    ///////////////////////
-    // Object properties //
-    ///////////////////////
+    void PhysicsObject::setForce (const math::Vector3& force)
+    {
+        store().setForce (m_body, force);
+
+        if (force.x != 0.f || force.y != 0.f || force.z != 0.f)
+        {
+            wake();
+        }
+    }
+
+
+    void PhysicsObject::addForce (const math::Vector3& force)
+    {
+        auto& bodies = store();
+        bodies.setForce (m_body, bodies.force (m_body) + force);
+        wake();
+    }
+
+
+    float PhysicsObject::getDrag() const
+    {
+        return store().drag[m_body];
+    }
+
+
+    void PhysicsObject::setDrag (const float drag)
+    {
+        store().drag[m_body] = drag;
+    }
 
-    tyga::Vector3 PhysicsObject::position() const
+
+    float PhysicsObject::getRestitution() const
+    {
+        return store().restitution[m_body];
+    }
+
+
+    void PhysicsObject::setRestitution (const float restitution)
+    {
+        store().restitution[m_body] = restitution;
+    }
+
+
+    std::uint32_t PhysicsObject::getLayers() const
+    {
+        return store().layers[m_body];
+    }
+
+
+    void PhysicsObject::setLayers (const std::uint32_t layers)
+    {
+        store().layers[m_body] = layers;
+    }
+
+
+    bool PhysicsObject::isAttached() const
     {
-        // Obtain the transform.
-        const auto transform = util::transformation (*this);
+        return store().hasFlag (m_body, BodyStore::Attached);
+    }
+
 
-        // Return the position vector.
-        return util::position (transform);
+    bool PhysicsObject::isEnabled() const
+    {
+        return !store().hasFlag (m_body, BodyStore::Disabled);
+    }
+
+
+    void PhysicsObject::setEnabled (const bool isEnabled)
+    {
+        store().setFlag (m_body, BodyStore::Disabled, !isEnabled);
+    }
+
+
+    bool PhysicsObject::isStatic() const
+    {
+        return store().hasFlag (m_body, BodyStore::Static);
+    }
+
+
+    void PhysicsObject::setStatic (const bool isStatic)
+    {
+        store().setFlag (m_body, BodyStore::Static, isStatic);
+    }
+
+
+    bool PhysicsObject::isContinuous() const
+    {
+        return store().hasFlag (m_body, BodyStore::Continuous);
+    }
+
+
+    void PhysicsObject::setContinuous (const bool isContinuous)
+    {
+        store().setFlag (m_body, BodyStore::Continuous, isContinuous);
+    }
+
+
+    bool PhysicsObject::isSleeping() const
+    {
+        return store().hasFlag (m_body, BodyStore::Sleeping);
+    }
+
+
+    void PhysicsObject::wake()
+    {
+        // Pre-condition: The object was created by a system.
+        assert (m_system);
+
+        m_system->wake (m_body);
+    }
+
+
+    float PhysicsObject::getMass() const
+    {
+        return 1.f / store().inverseMass[m_body];
     }
 
 
@@ -63,7 +227,20 @@ namespace spc
     {
         if (mass != 0.f)
         {
-            m_mass = mass;
+            store().inverseMass[m_body] = 1.f / mass;
         }
     }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    BodyStore& PhysicsObject::store() const
+    {
+        // Pre-condition: The object was created by a system.
+        assert (m_system);
+
+        return m_system->m_bodies;
+    }
 }
\ No newline at end of file
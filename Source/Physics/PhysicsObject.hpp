@@ -3,23 +3,33 @@
 
 
 // STL headers.
+#include <cstdint>
 #include <functional>
 #include <string>
 
 
-// Engine headers.
-#include <tyga/Actor.hpp>
-#include <tyga/Math.hpp>
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/AABB.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/ObjectRegistry.hpp>
 
 
 namespace spc
 {
+    // Forward declarations.
+    class BodyStore;
+    class PhysicsSystem;
+
+
     /// <summary>
-    /// A base class for every collidable type usable in the PhysicsSystem.
+    /// A base class for every collidable type usable in the PhysicsSystem. The simulation state of the object lives in
+    /// the BodyStore of the system which created it, the object itself is a handle to that state. Objects must be
+    /// created with PhysicsSystem::createObject.
     /// </summary>
-    class PhysicsObject : public tyga::ActorComponent
+    class PhysicsObject : public EngineComponent
     {
-        public:    
+        public:
 
             /// <summary>
             /// An enumeration representing each collidable type, allows for safe downcasting.
@@ -28,7 +38,8 @@ namespace spc
             {
                 Box     = 0,    //!< Represents a PhysicsBox object.
                 Plane   = 1,    //!< Represents a PhysicsPlane object.
-                Sphere  = 2     //!< Represents a PhysicsSphere object.
+                Sphere  = 2,    //!< Represents a PhysicsSphere object.
+                Count   = 3     //!< The number of types, new types must be added before this.
             };
 
 
@@ -37,12 +48,14 @@ namespace spc
             /////////////////////////////////
 
             PhysicsObject()                                         = default;
-            PhysicsObject (const PhysicsObject& copy)               = default;
-            PhysicsObject& operator= (const PhysicsObject& copy)    = default;
-            virtual ~PhysicsObject()                                = default;
-        
-            PhysicsObject (PhysicsObject&& move);
-            PhysicsObject& operator= (PhysicsObject&& move);
+            virtual ~PhysicsObject();
+
+            // The system tracks each object through the shared_ptr given by createObject, so objects can't be moved out of it.
+            PhysicsObject (PhysicsObject&& move)                    = delete;
+            PhysicsObject& operator= (PhysicsObject&& move)         = delete;
+
+            PhysicsObject (const PhysicsObject& copy)               = delete;
+            PhysicsObject& operator= (const PhysicsObject& copy)    = delete;
 
 
             ///////////////////////
@@ -53,13 +66,137 @@ namespace spc
             /// <returns> The castable type of the object. </returns>
             inline virtual Type getType() const = 0;
 
-            /// <summary> Calculate the world position of the object from the Actors transform. </summary>
+            /// <summary> Gets the unique ID given to the object by the PhysicsSystem which created it. </summary>
+            /// <returns> The ID of the object, this is zero if it wasn't created by a system. </returns>
+            unsigned int getID() const      { return m_id; }
+
+            /// <summary> Gets the handle of the object within the registry of its PhysicsSystem. </summary>
+            /// <returns> A handle which becomes invalid once the object is destroyed. </returns>
+            ObjectHandle getHandle() const  { return m_handle; }
+
+            /// <summary> Calculates the world space bounds of the object for use in the broadphase. </summary>
+            /// <returns> An axis-aligned box containing the entire object. </returns>
+            virtual AABB bounds() const = 0;
+
+            /// <summary>
+            /// Gets the world position of the object. This is taken from the Actor at the start of each tick and is
+            /// written back to the Actor once the tick has been simulated.
+            /// </summary>
             /// <returns> The position of the object. </returns>
-            tyga::Vector3 position() const;
+            math::Vector3 position() const;
+
+            /// <summary> Gets the transformation of the Actor as of the start of the tick, moved to the current position. </summary>
+            /// <returns> The transformation of the object. </returns>
+            math::Matrix4x4 transformation() const;
+
+            /// <summary> 
+            /// Blends the position of the object before and after the most recent simulation step by the interpolation
+            /// alpha of the system. This gives smooth rendering when a fixed timestep is used.
+            /// </summary>
+            /// <returns> The interpolated position of the object. </returns>
+            math::Vector3 interpolatedPosition() const;
+
+            /// <summary> Gets the transformation of the object moved to its interpolated position. </summary>
+            /// <returns> The interpolated transformation of the object. </returns>
+            math::Matrix4x4 interpolatedTransformation() const;
+
+            /// <summary> Moves the object within the simulation, this will be applied to the Actor at the end of the tick and wakes the object. </summary>
+            /// <param name="translation"> How much to move the object by. </param>
+            void translate (const math::Vector3& translation);
+
+            /// <summary> Gets the current velocity of the object. </summary>
+            /// <returns> The velocity in metres per second. </returns>
+            math::Vector3 getVelocity() const;
+
+            /// <summary> Sets the current velocity of the object, any velocity other than zero wakes the object. </summary>
+            /// <param name="velocity"> The new velocity in metres per second. </param>
+            void setVelocity (const math::Vector3& velocity);
+
+            /// <summary> Gets the force to be applied to the object on the next physics update. </summary>
+            /// <returns> The accumulated force in newtons. </returns>
+            math::Vector3 getForce() const;
+
+            /// <summary> Sets the force to be applied to the object on the next physics update, any force other than zero wakes the object. </summary>
+            /// <param name="force"> The new force in newtons. </param>
+            void setForce (const math::Vector3& force);
+
+            /// <summary> Adds to the force to be applied to the object on the next physics update, this wakes the object. </summary>
+            /// <param name="force"> The force to add in newtons. </param>
+            void addForce (const math::Vector3& force);
+
+            /// <summary> Gets the drag co-efficient which slows the object down. </summary>
+            /// <returns> The drag co-efficient. </returns>
+            float getDrag() const;
+
+            /// <summary> Sets the drag co-efficient which slows the object down. </summary>
+            /// <param name="drag"> The new drag co-efficient. </param>
+            void setDrag (const float drag);
+
+            /// <summary> Gets the amount of velocity maintained upon collision. </summary>
+            /// <returns> The restitution of the object. </returns>
+            float getRestitution() const;
+
+            /// <summary> Sets the amount of velocity maintained upon collision. </summary>
+            /// <param name="restitution"> The new restitution. </param>
+            void setRestitution (const float restitution);
+
+            /// <summary> Gets the layers of the object, which decide the force generators affecting it. </summary>
+            /// <returns> The layer mask of the object, layer 1 by default. </returns>
+            std::uint32_t getLayers() const;
+
+            /// <summary> Sets the layers of the object, a generator affects it when they share any bit. </summary>
+            /// <param name="layers"> The new layer mask, zero leaves the object unaffected by every generator. </param>
+            void setLayers (const std::uint32_t layers);
+
+            /// <summary> Determines whether the object was attached to an Actor and enabled at the start of the tick. </summary>
+            /// <returns> Whether the object is attached. </returns>
+            bool isAttached() const;
+
+            /// <summary> Determines whether the object takes part in the simulation whilst attached. </summary>
+            /// <returns> Whether the object is enabled, objects are enabled by default. </returns>
+            bool isEnabled() const;
+
+            /// <summary> 
+            /// Sets whether the object takes part in the simulation. From the start of the next tick a disabled object is
+            /// treated as if it were detached from its Actor: it isn't moved, collided with, pushed or written back. This
+            /// can be called from inside a collision callback.
+            /// </summary>
+            /// <param name="isEnabled"> Whether the object should be enabled. </param>
+            void setEnabled (const bool isEnabled);
+
+            /// <summary> Determines whether the object is immovable by forces and collisions. </summary>
+            /// <returns> Whether the object is static. </returns>
+            bool isStatic() const;
+
+            /// <summary> Sets whether the object is immovable by forces and collisions. </summary>
+            /// <param name="isStatic"> Whether the object should be static. </param>
+            void setStatic (const bool isStatic);
+
+            /// <summary> Determines whether continuous collision detection is used to stop the object passing through others. </summary>
+            /// <returns> Whether the object is continuous. </returns>
+            bool isContinuous() const;
+
+            /// <summary> 
+            /// Sets whether the motion of the object is swept each step to find impacts which happen between steps. This
+            /// is only supported by spheres, which are swept against planes and other spheres. It costs extra time each
+            /// step so should only be enabled on fast moving objects.
+            /// </summary>
+            /// <param name="isContinuous"> Whether the object should be continuous. </param>
+            void setContinuous (const bool isContinuous);
+
+            /// <summary> Determines whether the object has come to rest and is no longer being simulated. </summary>
+            /// <returns> Whether the object is asleep. </returns>
+            bool isSleeping() const;
+
+            /// <summary> 
+            /// Wakes the object so it's simulated again, along with every object it fell asleep with. Objects wake by
+            /// themselves when something touches them or a force is applied.
+            /// </summary>
+            void wake();
 
             /// <summary> Gets the mass of the object. </summary>
             /// <returns> The mass of the object in kilograms. </returns>
-            float getMass() const           { return m_mass; }
+            float getMass() const;
 
             /// <summary> Sets the mass of the object. </summary>
             /// <param name="mass"> A new mass in kilograms, this cannot be set to 0. </param>
@@ -71,26 +208,35 @@ namespace spc
             ////////////
 
             std::function<void (PhysicsObject&)> onCollide { }; //!< The function to be called upon contact with another object.
-            
+
 
             /////////////////
             // Public data //
-            /////////////////            
+            /////////////////
 
             std::string     name        = "N/A";    //!< The name of the object being collided with.
-            tyga::Vector3   velocity    { };        //!< The current velocity of the object.
-            tyga::Vector3   force       { };        //!< The force to be applied to the object on the next physics update.
-            float           drag        { 0.1f };   //!< A drag co-efficient which slows objects down.
-            float           restitution { 0.5f } ;  //!< The amount of velocity maintained upon collision.
-            bool            isStatic    { false };  //!< Determines whether the object should feature collision response.
 
         protected:
 
+            // The system assigns handles, the store updates them when bodies move and generators look them up.
+            friend class BodyStore;
+            friend class ForceGenerator;
+            friend class PhysicsSystem;
+
+
+            /// <summary> Obtains the store containing the state of the object. </summary>
+            /// <returns> The store of the owning system. </returns>
+            BodyStore& store() const;
+
+
             ///////////////////
             // Internal data //
             ///////////////////
 
-            float   m_mass  { 1.f };    //!< A mass value for the object in kilograms (KG).
+            PhysicsSystem*  m_system    { nullptr };    //!< The system which created the object.
+            unsigned int    m_body      { 0 };          //!< The index of the state of the object in the BodyStore.
+            unsigned int    m_id        { 0 };          //!< The unique ID of the object within its PhysicsSystem.
+            ObjectHandle    m_handle    { };            //!< Where the object is registered within its PhysicsSystem.
     };
 }
 
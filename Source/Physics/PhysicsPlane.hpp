@@ -20,12 +20,12 @@ namespace spc
             /////////////////////////////////
 
             PhysicsPlane()                                      = default;
-            PhysicsPlane (const PhysicsPlane& copy)             = default;
-            PhysicsPlane& operator= (const PhysicsPlane& copy)  = default;
+            PhysicsPlane (const PhysicsPlane& copy)             = delete;
+            PhysicsPlane& operator= (const PhysicsPlane& copy)  = delete;
             ~PhysicsPlane() override final                      = default;
         
-            PhysicsPlane (PhysicsPlane&& move);
-            PhysicsPlane& operator= (PhysicsPlane&& move);
+            PhysicsPlane (PhysicsPlane&& move)                  = delete;
+            PhysicsPlane& operator= (PhysicsPlane&& move)       = delete;
 
 
             ///////////////////////
@@ -36,9 +36,13 @@ namespace spc
             /// <returns> PhysicsObject::Type::Sphere. </returns>
             inline Type getType() const override final { return Type::Plane; }
 
+            /// <summary> Planes are infinite so their bounds contain all of space. </summary>
+            /// <returns> An infinite box. </returns>
+            AABB bounds() const override final  { return AABB::infinite(); }
+
             /// <summary> Calculates the normal vector of the plane from the actors transformation. </summary>
             /// <returns> The normal direction of the plane. </returns>
-            tyga::Vector3 normal() const;
+            math::Vector3 normal() const;
     };
 }
 
@@ -1,36 +1,15 @@
 #include "PhysicsSphere.hpp"
 
 
-// STL headers.
-#include <utility>
-
-
 namespace spc
 {
-    //////////////////
-    // Constructors //
-    //////////////////
+    ///////////////////////
+    // Object properties //
+    ///////////////////////
 
-    PhysicsSphere::PhysicsSphere (PhysicsSphere&& move)
+    AABB PhysicsSphere::bounds() const
     {
-        *this = std::move (move);
-    }
-
-
-    PhysicsSphere& PhysicsSphere::operator= (PhysicsSphere&& move)
-    {
-        if (this != &move)
-        {
-            // Ensure parent data is moved.
-            PhysicsObject::operator= (std::move (move));
-
-            // Move our data.
-            radius = move.radius;
-
-            // Reset primitives.
-            move.radius = 0.f;
-        }
-
-        return *this;
+        // The sphere extends by its radius in every direction.
+        return AABB::fromCentre (position(), { radius, radius, radius });
     }
 }
\ No newline at end of file
@@ -20,12 +20,12 @@ namespace spc
             /////////////////////////////////
 
             PhysicsSphere()                                         = default;
-            PhysicsSphere (const PhysicsSphere& copy)               = default;
-            PhysicsSphere& operator= (const PhysicsSphere& copy)    = default;
+            PhysicsSphere (const PhysicsSphere& copy)               = delete;
+            PhysicsSphere& operator= (const PhysicsSphere& copy)    = delete;
             ~PhysicsSphere() override final                         = default;
         
-            PhysicsSphere (PhysicsSphere&& move);
-            PhysicsSphere& operator= (PhysicsSphere&& move);
+            PhysicsSphere (PhysicsSphere&& move)                    = delete;
+            PhysicsSphere& operator= (PhysicsSphere&& move)         = delete;
 
 
             ///////////////////////
@@ -35,6 +35,10 @@ namespace spc
             /// <summary> Obtains the castable type of the PhysicsObject. </summary>
             /// <returns> PhysicsObject::Type::Sphere. </returns>
             inline Type getType() const override final { return Type::Sphere; }
+
+            /// <summary> Calculates the box surrounding the sphere. </summary>
+            /// <returns> The world space bounds of the sphere. </returns>
+            AABB bounds() const override final;
             
 
             /////////////////
@@ -2,15 +2,16 @@
 
 
 // STL headers.
+#include <algorithm>
+#include <array>
 #include <cassert>
-
-
-// Engine headers.
-#include <tyga/BasicWorldClock.hpp>
-#include <tyga/Log.hpp>
+#include <cmath>
+#include <cstring>
+#include <utility>
 
 
 // Personal headers.
+#include <Maths/BatchRK4Integrator.hpp>
 #include <Maths/RK4Integrator.hpp>
 #include <Maths/EulerIntegrator.hpp>
 #include <Physics/CollisionDetection.hpp>
@@ -47,13 +48,28 @@ namespace spc
     PhysicsSystem::PhysicsSystem (const unsigned int reserve)
     {
         // Allocate some memory.
-        m_objects.reserve (reserve);
+        m_registry.reserve (reserve);
+        m_bodies.reserve (reserve);
+        m_objectPool = std::make_shared<util::PoolResource>();
 
         // Set gravity to earths standard gravity.
         m_gravity = { 0.f, -9.81f, 0.f };
     }
 
 
+    PhysicsSystem::~PhysicsSystem()
+    {
+        // Any objects which outlive us must not try to access the store.
+        for (const auto owner : m_bodies.owners)
+        {
+            if (owner)
+            {
+                owner->m_system = nullptr;
+            }
+        }
+    }
+
+
     //////////////////////////////
     // Delegate implementations //
     //////////////////////////////
@@ -61,110 +77,1270 @@ namespace spc
     void PhysicsSystem::
     runloopWillBegin()
     {
-        // Perform collision detection.
-        /*for (const auto& element : m_objects)
+        // Lock every object once so they can't expire whilst we're testing them. They're held until the next tick.
+        lockObjects();
+
+        // Pull the latest transformations from the actors before using any positions.
+        syncFromActors();
+
+        // Anything disturbed since the last tick must be awake before pairs are found.
+        wakeAroundMovedStatics();
+        wakeGroups();
+
+        // Pairs are found now so queries are valid even if a fixed timestep doesn't simulate this frame.
+        buildColliders();
+        findPairs();
+        m_pairsFound = true;
+
+        // Bodies woken by a blast were paired as if they were resting, so their pairs are found again by the first step.
+        if (applyRadialImpulses())
+        {
+            wakeGroups();
+            m_pairsFound = false;
+        }
+    }
+
+    void PhysicsSystem::
+    runloopExecuteTask()
+    {
+        // Obtain the frames current time values, the force model doesn't vary over time so only the delta is needed.
+        const float frameTime = EngineClock::CurrentTickInterval();
+
+        if (m_deterministic)
+        {
+            // The frame time differs between runs, so it's ignored in favour of a fixed amount of simulation per tick.
+            for (auto steps = 0U; steps < m_tickSubsteps; ++steps)
+            {
+                step (m_substepSize);
+            }
+
+            m_alpha = 1.f;
+        }
+
+        else if (!m_fixedTimestep)
+        {
+            // Simulate the entire frame in one go, there is nothing to interpolate between.
+            step (frameTime);
+            m_alpha = 1.f;
+        }
+
+        else
+        {
+            // A long frame could take longer to simulate than the time it covers, causing every following frame to
+            // be even longer. Time beyond the maximum number of substeps is therefore discarded.
+            m_accumulator = std::min (m_accumulator + frameTime, m_substepSize * m_maxSubsteps);
+
+            for (auto steps = 0U; m_accumulator >= m_substepSize && steps < m_maxSubsteps; ++steps)
+            {
+                step (m_substepSize);
+                m_accumulator -= m_substepSize;
+            }
+
+            // The leftover time tells us how far between the previous and current state the frame is.
+            m_alpha = std::min (m_accumulator / m_substepSize, 1.f);
+        }
+
+        // Apply the results to the actors.
+        syncToActors();
+
+        if (m_deterministic)
+        {
+            m_stateHash = hashState();
+            ++m_tickCount;
+        }
+    }
+
+    void PhysicsSystem::
+    runloopDidEnd()
+    {
+        // Dead objects have already been unregistered, so pack the state of the remaining bodies together.
+        m_bodies.compact();
+    }
+
+
+    //////////////////////
+    // Actor management //
+    //////////////////////
+
+    void PhysicsSystem::lockObjects()
+    {
+        m_live.clear();
+
+        // Objects unregister themselves as they're destroyed so every registered object can be locked.
+        if (!m_deterministic)
+        {
+            for (const auto& object : m_registry.objects())
+            {
+                m_live.push_back (object.lock());
+                assert (m_live.back());
+            }
+        }
+
+        // The registry fills gaps left by destroyed objects, so its order depends on what was destroyed when. Bodies are
+        // appended on creation and compacted without reordering, so they're always in creation order.
+        else
+        {
+            for (const auto owner : m_bodies.owners)
+            {
+                if (owner)
+                {
+                    m_live.push_back (m_registry.lock (owner->m_handle));
+                    assert (m_live.back());
+                }
+            }
+        }
+    }
+
+
+    std::uint64_t PhysicsSystem::hashState() const
+    {
+        const auto& bodies  = m_bodies;
+        auto hash           = std::uint64_t { 14695981039346656037ULL };
+
+        const auto combine = [&hash] (const std::uint32_t value)
+        {
+            for (auto byte = 0U; byte < 4; ++byte)
+            {
+                hash ^= (value >> (byte * 8)) & 0xFF;
+                hash *= 1099511628211ULL;
+            }
+        };
+
+        // Bit patterns are hashed rather than values so a difference in the last bit is still caught.
+        const auto bits = [] (const float value)
+        {
+            std::uint32_t result;
+            std::memcpy (&result, &value, sizeof (result));
+            return result;
+        };
+
+        for (auto i = 0U; i < bodies.size(); ++i)
+        {
+            if (bodies.owners[i])
+            {
+                combine (bodies.owners[i]->m_id);
+                combine (bits (bodies.positionX[i]));
+                combine (bits (bodies.positionY[i]));
+                combine (bits (bodies.positionZ[i]));
+                combine (bits (bodies.velocityX[i]));
+                combine (bits (bodies.velocityY[i]));
+                combine (bits (bodies.velocityZ[i]));
+                combine (bodies.flags[i]);
+            }
+        }
+
+        return hash;
+    }
+
+
+    void PhysicsSystem::syncFromActors()
+    {
+        auto& bodies = m_bodies;
+        m_movedStatics.clear();
+
+        for (auto i = 0U; i < bodies.size(); ++i)
         {
-            const auto lock = element.lock();
+            const auto owner = bodies.owners[i];
 
-            if (lock && lock->getType() == PhysicsObject::Type::Sphere)
+            if (owner)
             {
-                // We can safely downcast because of the implementation of the getType function.
-                auto& object = *std::static_pointer_cast<PhysicsSphere> (lock);
+                // Objects can be attached, detached, enabled and disabled at any time. Disabled objects are left alone.
+                const auto actor       = bodies.hasFlag (i, BodyStore::Disabled) ? nullptr : owner->Actor();
+                const auto wasAttached = bodies.hasFlag (i, BodyStore::Attached);
+                bodies.setFlag (i, BodyStore::Attached, actor != nullptr);
 
-                // Ensure the actor is valid.
-                const auto actor = object.Actor();
                 if (actor)
                 {
-                    // Obtain the transform and position of the sphere.
-                    auto transform      = actor->Transformation();
-                    const auto position = util::position (transform);
+                    const auto transform = actor->Transformation();
+                    const auto position  = util::position (transform);
+
+                    // The game may have moved the actor since we last wrote to it.
+                    const auto moved = wasAttached && (position.x != bodies.positionX[i] ||
+                                                       position.y != bodies.positionY[i] ||
+                                                       position.z != bodies.positionZ[i]);
+
+                    if (moved && bodies.hasFlag (i, BodyStore::Static))
+                    {
+                        m_movedStatics.push_back (i);
+                    }
+
+                    else if (moved)
+                    {
+                        wake (i);
+                    }
+
+                    bodies.transforms[i] = transform;
+                    bodies.setPosition (i, position);
 
-                    if (position.y < object.radius)
+                    // Newly attached bodies have nothing to interpolate from.
+                    if (!wasAttached)
                     {
-                        object.velocity.y = 0.f;
-                        transform._31 = object.radius;
-                        actor->setTransformation (transform);
+                        bodies.previousX[i] = position.x;
+                        bodies.previousY[i] = position.y;
+                        bodies.previousZ[i] = position.z;
                     }
                 }
             }
-        }*/
-        
-        // Test every object against every other object.
-        for (auto i = 0U; i < m_objects.size(); ++i)
-        {
-            // Don't bother checking anything if the object has expired.
-            const auto lockI = m_objects[i].lock();
+        }
+    }
+
+
+    void PhysicsSystem::syncToActors()
+    {
+        // Sleeping bodies are written too, otherwise a body which fell asleep during an earlier substep would never
+        // have its final position applied and syncFromActors would think the game had moved it.
+        const auto& bodies   = m_bodies;
+        const auto simulated = BodyStore::Alive | BodyStore::Attached;
+        const auto relevant  = simulated | BodyStore::Static;
 
-            if (lockI)
+        for (auto i = 0U; i < bodies.size(); ++i)
+        {
+            if ((bodies.flags[i] & relevant) == simulated)
             {
-                for (auto j = i + 1; j < m_objects.size(); ++j)
+                const auto actor = bodies.owners[i]->Actor();
+
+                if (actor)
                 {
-                    // Again, don't bother checking for collision if the object has expired.
-                    const auto lockJ = m_objects[j].lock();
+                    // Only the translation is simulated so the rest of the transform is left untouched.
+                    auto transform = bodies.transforms[i];
+                    transform._30  = bodies.positionX[i];
+                    transform._31  = bodies.positionY[i];
+                    transform._32  = bodies.positionZ[i];
 
-                    // Don't check static on static collision.
-                    if (lockJ && (!lockI->isStatic || !lockJ->isStatic))
-                    {
-                        CollisionDetection::detectCollision (*lockI, *lockJ);
-                    }
+                    actor->setTransformation (transform);
                 }
             }
         }
     }
 
-    void PhysicsSystem::
-    runloopExecuteTask()
+
+    ////////////////
+    // Simulation //
+    ////////////////
+
+    void PhysicsSystem::step (const float deltaTime)
+    {
+        // Remember where everything was so rendering can interpolate.
+        auto& bodies = m_bodies;
+
+        std::copy (bodies.positionX.begin(), bodies.positionX.end(), bodies.previousX.begin());
+        std::copy (bodies.positionY.begin(), bodies.positionY.end(), bodies.previousY.begin());
+        std::copy (bodies.positionZ.begin(), bodies.positionZ.end(), bodies.previousZ.begin());
+
+        // Find the pairs which could be colliding, unless nothing has moved since they were last found.
+        if (!m_pairsFound)
+        {
+            buildColliders();
+            findPairs();
+        }
+
+        m_pairsFound = false;
+
+        // Find every contact in parallel, resolve them and then let the game know about them.
+        detectContacts();
+        wakeTouched();
+        resolveContacts (deltaTime);
+        triggerCollisionEvents();
+
+        // Resting bodies have only just had gravity cancelled by the solver, so they're judged before integration.
+        updateSleep (deltaTime);
+        integrate (deltaTime);
+        sweepContinuous (deltaTime);
+
+        // Particles only read the scene, so they use the colliders from the start of the step.
+        m_particles.update (deltaTime, m_gravity, m_colliders, m_pool);
+
+        // Everything cached this step becomes available to the next.
+        m_contacts.advance();
+    }
+
+
+    void PhysicsSystem::detectContacts()
     {
-        // Obtain the frames current time values.
-        const float time      = tyga::BasicWorldClock::CurrentTime();
-        const float deltaTime = tyga::BasicWorldClock::CurrentTickInterval();
+        // Each chunk only contains one combination of types so it can call its handler directly.
+        sortPairs();
 
-        for (const auto& element : m_objects) 
+        m_pool.parallelFor (m_chunkCount, [=] (const unsigned int chunk)
         {
-            // Only process the sphere if the object exists and it has an actor.
-            const auto lock  = element.lock();
-            const auto actor = lock ? lock->Actor() : nullptr;
-        
-            if (actor) 
-            { 
-                // Cache the physics object.
-                auto& object = *lock;
+            auto& buffer = m_chunks[chunk];
+
+            buffer.manifolds.clear();
+            buffer.separations.clear();
+
+            for (auto i = buffer.begin; i < buffer.end; ++i)
+            {
+                const auto& lhs = *m_live[m_pairs[i].lhs];
+                const auto& rhs = *m_live[m_pairs[i].rhs];
+                const auto key  = ContactCache::makeKey (lhs.m_id, rhs.m_id);
 
-                if (!object.isStatic)
+                const auto& lhsCollider = m_colliders[m_pairs[i].lhs];
+                const auto& rhsCollider = m_colliders[m_pairs[i].rhs];
+
+                // An axis which separated the pair last step usually still does, checking it is much cheaper.
+                const auto cached = m_contacts.find (key);
+
+                if (cached && cached->separated && CollisionDetection::isSeparated (lhsCollider, rhsCollider, cached->axis))
                 {
-                    // Create a function to calculate the acceleration of the object.
-                    const auto calcAccel = [&] (const tyga::Vector3& position, const tyga::Vector3& velocity, const float deltaTime)
-                    {
-                        const auto force   = object.force / object.getMass(),
-                                   gravity = m_gravity,
-                                   drag    = velocity * -object.drag;
-                        
-                        return force + drag + gravity;
-                    };
-            
-                    // Use the Runge-Kutta order of 4 method to integrate an accurate solution.
-                    tyga::Vector3 translation { };
-                    RK4Integrator<tyga::Vector3, float>::integrate (translation, object.velocity, calcAccel, time, deltaTime);
+                    buffer.separations.emplace_back (key, cached->axis);
+                    continue;
+                }
 
-                    // Update the transformation.
-                    actor->setTransformation (actor->Transformation() * util::translate (translation.x, translation.y, translation.z));
+                auto manifold = ContactManifold { };
 
-                    // Reset the applied force.
-                    object.force = tyga::Vector3(0,0,0);
+                if (buffer.handler (lhsCollider, rhsCollider, manifold))
+                {
+                    manifold.pair    = i;
+                    manifold.lhsBody = lhs.m_body;
+                    manifold.rhsBody = rhs.m_body;
+                    manifold.key     = key;
+                    buffer.manifolds.push_back (manifold);
+                }
+
+                else if (math::dot (manifold.normal, manifold.normal) > 0.f)
+                {
+                    buffer.separations.emplace_back (key, manifold.normal);
                 }
             }
+        });
+
+        // Merge the buffers in chunk order.
+        m_manifolds.clear();
+
+        for (auto chunk = 0U; chunk < m_chunkCount; ++chunk)
+        {
+            const auto& buffer = m_chunks[chunk];
+
+            m_manifolds.insert (m_manifolds.end(), buffer.manifolds.begin(), buffer.manifolds.end());
+
+            for (const auto& separation : buffer.separations)
+            {
+                auto& entry     = m_contacts.insert (separation.first);
+                entry.separated = true;
+                entry.axis      = separation.second;
+            }
         }
     }
 
-    void PhysicsSystem::
-    runloopDidEnd()
+
+    void PhysicsSystem::resolveContacts (const float deltaTime)
     {
-        // Remove any dead objects.
-        const auto removeCondition = [] (const std::weak_ptr<PhysicsObject>& object) 
-        { 
-            return object.expired(); 
+        // Islands are built from the objects of each manifold.
+        m_contactPairs.clear();
+
+        for (const auto& manifold : m_manifolds)
+        {
+            m_contactPairs.push_back (m_pairs[manifold.pair]);
+        }
+
+        // Static objects aren't modified by collisions so they can safely be shared between islands.
+        const auto isStatic = [this] (const unsigned int object)
+        {
+            return m_live[object]->isStatic();
         };
 
-        util::unorderedRemove<std::weak_ptr<PhysicsObject>> (m_objects, removeCondition);
+        m_islands.build (static_cast<unsigned int> (m_live.size()), m_contactPairs, isStatic);
+
+        // Islands don't share moving objects so they're solved in parallel, each island is solved in order.
+        m_solver.beginStep (m_manifolds, m_bodies.size(), m_contacts);
+
+        m_pool.parallelFor (m_islands.getIslandCount(), [=] (const unsigned int island)
+        {
+            m_solver.solveIsland (m_bodies, m_manifolds, m_islands.pairsBegin (island), m_islands.pairsEnd (island), deltaTime);
+        });
+
+        m_solver.endStep (m_bodies, m_manifolds, deltaTime, m_contacts);
+    }
+
+
+    void PhysicsSystem::wakeTouched()
+    {
+        // Every pair contains at least one awake body, so any sleeping body in a manifold is being touched by one.
+        for (const auto& manifold : m_manifolds)
+        {
+            wake (manifold.lhsBody);
+            wake (manifold.rhsBody);
+        }
+
+        wakeGroups();
+    }
+
+
+    void PhysicsSystem::updateSleep (const float deltaTime)
+    {
+        if (!m_sleeping)
+        {
+            return;
+        }
+
+        // Only bodies which are awake and simulated can fall asleep.
+        const auto simulated = BodyStore::Alive | BodyStore::Attached;
+        const auto relevant  = simulated | BodyStore::Static | BodyStore::Sleeping;
+        const auto restSpeed = util::squared (m_sleepVelocity);
+
+        auto& bodies = m_bodies;
+        m_sleepReady.assign (bodies.size(), 0);
+
+        for (auto i = 0U; i < bodies.size(); ++i)
+        {
+            if ((bodies.flags[i] & relevant) == simulated)
+            {
+                const auto velocity = bodies.velocity (i);
+
+                bodies.restTime[i]   = math::dot (velocity, velocity) < restSpeed ? bodies.restTime[i] + deltaTime : 0.f;
+                bodies.sleepGroup[i] = bodies.owners[i]->m_id;
+                m_sleepReady[i]      = bodies.restTime[i] >= m_timeToSleep ? 1 : 0;
+            }
+        }
+
+        // Islands sleep as a whole, otherwise a body resting on another could be left floating when it moves away.
+        for (auto island = 0U; island < m_islands.getIslandCount(); ++island)
+        {
+            auto ready = std::uint8_t { 1 };
+            auto group = 0U;
+
+            for (auto pair = m_islands.pairsBegin (island); pair != m_islands.pairsEnd (island); ++pair)
+            {
+                for (const auto body : { m_manifolds[*pair].lhsBody, m_manifolds[*pair].rhsBody })
+                {
+                    if (!bodies.hasFlag (body, BodyStore::Static))
+                    {
+                        ready &= m_sleepReady[body];
+                        group  = group == 0 ? bodies.sleepGroup[body] : group;
+                    }
+                }
+            }
+
+            for (auto pair = m_islands.pairsBegin (island); pair != m_islands.pairsEnd (island); ++pair)
+            {
+                for (const auto body : { m_manifolds[*pair].lhsBody, m_manifolds[*pair].rhsBody })
+                {
+                    if (!bodies.hasFlag (body, BodyStore::Static))
+                    {
+                        m_sleepReady[body]      = ready;
+                        bodies.sleepGroup[body] = group;
+                    }
+                }
+            }
+        }
+
+        // Sleeping bodies keep their position but lose any motion.
+        for (auto i = 0U; i < bodies.size(); ++i)
+        {
+            if (m_sleepReady[i])
+            {
+                bodies.setFlag (i, BodyStore::Sleeping, true);
+                bodies.setVelocity (i, { 0.f, 0.f, 0.f });
+                bodies.setForce (i, { 0.f, 0.f, 0.f });
+            }
+        }
+    }
+
+
+    void PhysicsSystem::triggerCollisionEvents()
+    {
+        // Events run game code which isn't thread safe so they're triggered on this thread.
+        for (const auto& manifold : m_manifolds)
+        {
+            auto& lhs = *m_live[m_pairs[manifold.pair].lhs];
+            auto& rhs = *m_live[m_pairs[manifold.pair].rhs];
+
+            if (lhs.onCollide)
+            {
+                lhs.onCollide (rhs);
+            }
+
+            if (rhs.onCollide)
+            {
+                rhs.onCollide (lhs);
+            }
+        }
+    }
+
+
+    void PhysicsSystem::integrate (const float deltaTime)
+    {
+        // Bodies are split into fixed size ranges so the work done by each task doesn't depend on the thread count.
+        const auto rangeSize  = 1024U;
+        const auto count      = m_bodies.size();
+        const auto rangeCount = (count + rangeSize - 1) / rangeSize;
+
+        m_motion.resize (count);
+
+        m_pool.parallelFor (rangeCount, [=] (const unsigned int range)
+        {
+            const auto first = range * rangeSize;
+            accumulateForces (first, std::min (first + rangeSize, count));
+        });
+
+        m_pool.parallelFor (rangeCount, [=] (const unsigned int range)
+        {
+            const auto first = range * rangeSize;
+            integrateRange (first, std::min (first + rangeSize, count), deltaTime);
+        });
+    }
+
+
+    void PhysicsSystem::accumulateForces (const unsigned int first, const unsigned int last)
+    {
+        // Only bodies which exist, are attached to an actor and aren't static or sleeping get simulated.
+        const auto simulated = BodyStore::Alive | BodyStore::Attached;
+        const auto relevant  = simulated | BodyStore::Static | BodyStore::Sleeping;
+
+        auto& bodies = m_bodies;
+
+        for (auto i = first; i < last; ++i)
+        {
+            m_motion[i] = (bodies.flags[i] & relevant) == simulated ? 1.f : 0.f;
+        }
+
+        if (m_forces.empty())
+        {
+            return;
+        }
+
+        ForceBatch batch { };
+        batch.first         = first;
+        batch.last          = last;
+        batch.positionX     = bodies.positionX.data();
+        batch.positionY     = bodies.positionY.data();
+        batch.positionZ     = bodies.positionZ.data();
+        batch.velocityX     = bodies.velocityX.data();
+        batch.velocityY     = bodies.velocityY.data();
+        batch.velocityZ     = bodies.velocityZ.data();
+        batch.inverseMass   = bodies.inverseMass.data();
+        batch.motion        = m_motion.data();
+        batch.layers        = bodies.layers.data();
+        batch.forceX        = bodies.forceX.data();
+        batch.forceY        = bodies.forceY.data();
+        batch.forceZ        = bodies.forceZ.data();
+
+        // Generators add to whatever the game applied, so the integrator sees the total as a constant force.
+        for (const auto& generator : m_forces)
+        {
+            generator->apply (batch);
+        }
+    }
+
+
+    void PhysicsSystem::integrateRange (const unsigned int first, const unsigned int last, const float deltaTime)
+    {
+        auto& bodies = m_bodies;
+
+        // Acceleration is force * inverseMass + gravity - drag * velocity, the batch integrator steps every body
+        // along one axis at a time using the Runge-Kutta order of 4 method.
+        const auto batch = BatchRK4Integrator::Bodies { &bodies.inverseMass[first], &bodies.drag[first], &m_motion[first], last - first };
+
+        BatchRK4Integrator::integrate ({ &bodies.positionX[first], &bodies.velocityX[first], &bodies.forceX[first], m_gravity.x }, batch, deltaTime);
+        BatchRK4Integrator::integrate ({ &bodies.positionY[first], &bodies.velocityY[first], &bodies.forceY[first], m_gravity.y }, batch, deltaTime);
+        BatchRK4Integrator::integrate ({ &bodies.positionZ[first], &bodies.velocityZ[first], &bodies.forceZ[first], m_gravity.z }, batch, deltaTime);
+
+        // Reset the applied force of every simulated body.
+        for (auto i = first; i < last; ++i)
+        {
+            const auto keep = 1.f - m_motion[i];
+
+            bodies.forceX[i] *= keep;
+            bodies.forceY[i] *= keep;
+            bodies.forceZ[i] *= keep;
+        }
+    }
+
+
+    void PhysicsSystem::sweepContinuous (const float deltaTime)
+    {
+        // Only simulated spheres which asked for it are swept.
+        const auto simulated = BodyStore::Alive | BodyStore::Attached | BodyStore::Continuous;
+        const auto relevant  = simulated | BodyStore::Static | BodyStore::Sleeping;
+
+        // A body which keeps hitting things loses the rest of the step after this many impacts.
+        const auto maxImpacts = 4U;
+
+        auto& bodies = m_bodies;
+
+        // The broadphase holds the bounds from the start of the step, so queries are grown by the furthest any object
+        // has moved since then to catch objects which moved into the path.
+        auto furthest = -1.f;
+
+        for (auto i = 0U; i < m_live.size(); ++i)
+        {
+            const auto body = m_live[i]->m_body;
+
+            if ((bodies.flags[body] & relevant) != simulated || m_colliders[i].type != PhysicsObject::Type::Sphere)
+            {
+                continue;
+            }
+
+            if (furthest < 0.f)
+            {
+                furthest = 0.f;
+
+                for (auto other = 0U; other < bodies.size(); ++other)
+                {
+                    furthest = std::max (furthest, util::sqrLength (bodies.position (other) - bodies.previousPosition (other)));
+                }
+
+                furthest = std::sqrt (furthest);
+            }
+
+            // Spheres moving less than their radius can't pass through anything the narrowphase would miss.
+            auto sphere   = m_colliders[i];
+            sphere.centre = bodies.previousPosition (body);
+            auto motion   = bodies.position (body) - sphere.centre;
+
+            if (util::sqrLength (motion) <= util::squared (sphere.radius))
+            {
+                continue;
+            }
+
+            // How much of the step has been used up by earlier impacts.
+            auto elapsed = 0.f;
+
+            for (auto impact = 0U; impact <= maxImpacts; ++impact)
+            {
+                auto earliest = 1.f;
+                auto hit      = i;
+                auto normal   = math::Vector3 (0.f, 0.f, 0.f);
+
+                // Only objects near the remaining path and infinite objects can be hit. Candidates are tested in the
+                // order of m_live so ties are broken the same way whichever broadphase found them.
+                const auto end   = sphere.centre + motion;
+                const auto swept = AABB::merge ({ sphere.centre, sphere.centre }, { end, end });
+
+                m_queryResults.clear();
+                queryIndices (swept.fattened (sphere.radius + furthest), m_queryResults);
+                m_queryResults.insert (m_queryResults.end(), m_infinite.cbegin(), m_infinite.cend());
+                std::sort (m_queryResults.begin(), m_queryResults.end());
+
+                for (const auto j : m_queryResults)
+                {
+                    const auto& other = m_colliders[j];
+                    auto time         = 1.f;
+
+                    if (j == i || !other.attached)
+                    {
+                        continue;
+                    }
+
+                    if (other.type == PhysicsObject::Type::Plane)
+                    {
+                        if (CollisionDetection::sweepSpherePlane (sphere, motion, other, time) && time < earliest)
+                        {
+                            earliest = time;
+                            hit      = j;
+                            normal   = other.normal;
+                        }
+                    }
+
+                    else if (other.type == PhysicsObject::Type::Sphere)
+                    {
+                        // Other spheres are moved along their own path for the same part of the step.
+                        const auto otherBody  = m_live[j]->m_body;
+                        const auto start      = bodies.previousPosition (otherBody);
+                        const auto path       = bodies.position (otherBody) - start;
+
+                        auto moving           = other;
+                        moving.centre         = start + path * elapsed;
+                        const auto remaining  = path * (1.f - elapsed);
+
+                        if (CollisionDetection::sweepSphereSphere (sphere, motion, moving, remaining, time) && time < earliest)
+                        {
+                            earliest = time;
+                            hit      = j;
+                            normal   = math::unit ((sphere.centre + motion * time) - (moving.centre + remaining * time));
+                        }
+                    }
+                }
+
+                // Stop at the impact, or finish the step if nothing was hit.
+                sphere.centre += motion * earliest;
+
+                if (hit == i || impact == maxImpacts)
+                {
+                    break;
+                }
+
+                // Bounce off whatever was hit like the solver would, static objects have no inverse mass.
+                const auto otherBody  = m_live[hit]->m_body;
+                const auto lhsInvMass = bodies.inverseMass[body];
+                const auto rhsInvMass = bodies.hasFlag (otherBody, BodyStore::Static) ? 0.f : bodies.inverseMass[otherBody];
+                const auto approach   = math::dot (bodies.velocity (body) - bodies.velocity (otherBody), normal);
+
+                if (approach < 0.f)
+                {
+                    const auto restitution = std::max (bodies.restitution[body], bodies.restitution[otherBody]);
+                    const auto impulse     = normal * (-(1.f + restitution) * approach / (lhsInvMass + rhsInvMass));
+
+                    bodies.setVelocity (body, bodies.velocity (body) + impulse * lhsInvMass);
+
+                    if (rhsInvMass > 0.f)
+                    {
+                        wake (otherBody);
+                        bodies.setVelocity (otherBody, bodies.velocity (otherBody) - impulse * rhsInvMass);
+                    }
+                }
+
+                // The rest of the step follows the new velocity.
+                elapsed += (1.f - elapsed) * earliest;
+                motion   = bodies.velocity (body) * ((1.f - elapsed) * deltaTime);
+            }
+
+            bodies.setPosition (body, sphere.centre);
+        }
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void PhysicsSystem::setFixedTimestep (const bool fixedTimestep)
+    {
+        // Time accumulated under the old mode shouldn't leak into the new one.
+        m_fixedTimestep = fixedTimestep;
+        m_accumulator   = 0.f;
+        m_alpha         = 1.f;
+    }
+
+
+    void PhysicsSystem::setDeterministic (const bool deterministic)
+    {
+        // Replays are compared from the tick the mode was enabled, with nothing left over from before.
+        m_deterministic = deterministic;
+        m_accumulator   = 0.f;
+        m_alpha         = 1.f;
+        m_stateHash     = 0;
+        m_tickCount     = 0;
+    }
+
+
+    void PhysicsSystem::setSubstepsPerTick (const unsigned int substeps)
+    {
+        if (substeps > 0)
+        {
+            m_tickSubsteps = substeps;
+        }
+    }
+
+
+    void PhysicsSystem::setSeed (const unsigned int seed)
+    {
+        m_seed = seed;
+        m_random.seed (seed);
+    }
+
+
+    void PhysicsSystem::setSubstepSize (const float substepSize)
+    {
+        if (substepSize > 0.f)
+        {
+            m_substepSize = substepSize;
+        }
+    }
+
+
+    void PhysicsSystem::setMaxSubsteps (const unsigned int maxSubsteps)
+    {
+        if (maxSubsteps > 0)
+        {
+            m_maxSubsteps = maxSubsteps;
+        }
+    }
+
+
+    void PhysicsSystem::setSleepingEnabled (const bool sleeping)
+    {
+        m_sleeping = sleeping;
+
+        if (!sleeping)
+        {
+            for (auto i = 0U; i < m_bodies.size(); ++i)
+            {
+                m_bodies.setFlag (i, BodyStore::Sleeping, false);
+                m_bodies.restTime[i] = 0.f;
+            }
+
+            m_wakeGroups.clear();
+        }
+    }
+
+
+    void PhysicsSystem::setSleepVelocity (const float velocity)
+    {
+        if (velocity >= 0.f)
+        {
+            m_sleepVelocity = velocity;
+        }
+    }
+
+
+    void PhysicsSystem::setTimeToSleep (const float time)
+    {
+        if (time > 0.f)
+        {
+            m_timeToSleep = time;
+        }
+    }
+
+
+    void PhysicsSystem::query (const AABB& bounds, std::vector<std::shared_ptr<PhysicsObject>>& results) const
+    {
+        std::vector<unsigned int> indices { };
+        queryIndices (bounds, indices);
+
+        for (const auto index : indices)
+        {
+            results.push_back (m_live[index]);
+        }
+    }
+
+
+    void PhysicsSystem::applyRadialImpulse (const math::Vector3& centre, const float radius, const float strength,
+        const Falloff falloff, const PhysicsObject* const source)
+    {
+        if (radius > 0.f)
+        {
+            RadialImpulse impulse { };
+            impulse.centre      = centre;
+            impulse.radius      = radius;
+            impulse.strength    = strength;
+            impulse.falloff     = falloff;
+            impulse.source      = source ? source->getID() : 0;
+
+            m_impulses.push_back (impulse);
+        }
+    }
+
+
+    void PhysicsSystem::addForceGenerator (const std::shared_ptr<ForceGenerator>& generator)
+    {
+        if (generator && std::find (m_forces.cbegin(), m_forces.cend(), generator) == m_forces.cend())
+        {
+            m_forces.push_back (generator);
+            wakeForcedBodies (*generator);
+        }
+    }
+
+
+    bool PhysicsSystem::removeForceGenerator (const std::shared_ptr<ForceGenerator>& generator)
+    {
+        const auto size = m_forces.size();
+        util::stableRemove (m_forces, [&] (const std::shared_ptr<ForceGenerator>& existing) { return existing == generator; });
+
+        return m_forces.size() != size;
+    }
+
+
+    //////////////
+    // Sleeping //
+    //////////////
+
+    void PhysicsSystem::wake (const unsigned int body)
+    {
+        if (m_bodies.hasFlag (body, BodyStore::Sleeping))
+        {
+            m_bodies.setFlag (body, BodyStore::Sleeping, false);
+            m_bodies.restTime[body] = 0.f;
+            m_wakeGroups.push_back (m_bodies.sleepGroup[body]);
+        }
+    }
+
+
+    void PhysicsSystem::wakeGroups()
+    {
+        if (m_wakeGroups.empty())
+        {
+            return;
+        }
+
+        // Any number of groups can then be woken in a single pass over the bodies.
+        std::sort (m_wakeGroups.begin(), m_wakeGroups.end());
+
+        auto& bodies = m_bodies;
+
+        for (auto i = 0U; i < bodies.size(); ++i)
+        {
+            if (bodies.hasFlag (i, BodyStore::Sleeping) && std::binary_search (m_wakeGroups.begin(), m_wakeGroups.end(), bodies.sleepGroup[i]))
+            {
+                bodies.setFlag (i, BodyStore::Sleeping, false);
+                bodies.restTime[i] = 0.f;
+            }
+        }
+
+        m_wakeGroups.clear();
+    }
+
+
+    void PhysicsSystem::wakeAroundMovedStatics()
+    {
+        // Static bodies are rarely moved so testing them against every sleeping body is cheap enough.
+        auto& bodies = m_bodies;
+
+        for (const auto moved : m_movedStatics)
+        {
+            const auto bounds = bodies.owners[moved]->bounds();
+
+            for (auto i = 0U; i < bodies.size(); ++i)
+            {
+                if (bodies.hasFlag (i, BodyStore::Sleeping) && bounds.overlaps (bodies.owners[i]->bounds()))
+                {
+                    wake (i);
+                }
+            }
+        }
+    }
+
+
+    void PhysicsSystem::wakeForcedBodies (const ForceGenerator& generator)
+    {
+        // Only sleeping bodies which would otherwise be simulated are given a weight, so nothing else is touched.
+        const auto asleep   = BodyStore::Alive | BodyStore::Attached | BodyStore::Sleeping;
+        const auto relevant = asleep | BodyStore::Static;
+
+        auto& bodies     = m_bodies;
+        const auto count = bodies.size();
+
+        std::vector<float> motion (count), forceX (count), forceY (count), forceZ (count);
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            motion[i] = (bodies.flags[i] & relevant) == asleep ? 1.f : 0.f;
+        }
+
+        ForceBatch batch { };
+        batch.first         = 0;
+        batch.last          = count;
+        batch.positionX     = bodies.positionX.data();
+        batch.positionY     = bodies.positionY.data();
+        batch.positionZ     = bodies.positionZ.data();
+        batch.velocityX     = bodies.velocityX.data();
+        batch.velocityY     = bodies.velocityY.data();
+        batch.velocityZ     = bodies.velocityZ.data();
+        batch.inverseMass   = bodies.inverseMass.data();
+        batch.motion        = motion.data();
+        batch.layers        = bodies.layers.data();
+        batch.forceX        = forceX.data();
+        batch.forceY        = forceY.data();
+        batch.forceZ        = forceZ.data();
+
+        generator.apply (batch);
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            if (forceX[i] != 0.f || forceY[i] != 0.f || forceZ[i] != 0.f)
+            {
+                wake (i);
+            }
+        }
+    }
+
+
+    ////////////////////
+    // Pair detection //
+    ////////////////////
+
+    void PhysicsSystem::buildColliders()
+    {
+        // Objects are split into fixed size ranges, like bodies are during integration.
+        const auto rangeSize  = 1024U;
+        const auto count      = static_cast<unsigned int> (m_live.size());
+        const auto rangeCount = (count + rangeSize - 1) / rangeSize;
+
+        m_colliders.resize (count);
+
+        m_pool.parallelFor (rangeCount, [=] (const unsigned int range)
+        {
+            const auto last = std::min ((range + 1) * rangeSize, count);
+
+            for (auto i = range * rangeSize; i < last; ++i)
+            {
+                m_colliders[i] = Collider::fromObject (*m_live[i]);
+            }
+        });
+    }
+
+
+    void PhysicsSystem::findPairs()
+    {
+        m_pairs.clear();
+
+        // Sleeping objects don't move so, like static objects, they only need to be paired with objects which do.
+        const auto isResting = [] (const PhysicsObject& object)
+        {
+            return object.isStatic() || object.isSleeping();
+        };
+
+        // Separate the finite objects from the infinite ones.
+        m_proxies.clear();
+        m_infinite.clear();
+
+        for (auto i = 0U; i < m_live.size(); ++i)
+        {
+            const auto& object = *m_live[i];
+
+            if (m_colliders[i].type == PhysicsObject::Type::Plane)
+            {
+                m_infinite.push_back (i);
+            }
+
+            // Unattached objects can't collide with anything, so they're kept out of the broadphase altogether.
+            else if (m_colliders[i].attached)
+            {
+                BroadphaseProxy proxy { };
+                proxy.bounds   = m_colliders[i].bounds();
+                proxy.index    = i;
+                proxy.id       = object.getID();
+                proxy.isStatic = isResting (object);
+                m_proxies.push_back (proxy);
+            }
+        }
+
+        // Remember which broadphase is up to date so queries use the right one.
+        m_queryMode = m_broadphaseMode;
+
+        if (m_broadphaseMode == BroadphaseMode::BruteForce)
+        {
+            // Test every object against every other object.
+            for (auto i = 0U; i < m_live.size(); ++i)
+            {
+                for (auto j = i + 1; j < m_live.size(); ++j)
+                {
+                    // Don't check static on static collision.
+                    if (!isResting (*m_live[i]) || !isResting (*m_live[j]))
+                    {
+                        BroadphasePair pair { };
+                        pair.lhs = i;
+                        pair.rhs = j;
+                        m_pairs.push_back (pair);
+                    }
+                }
+            }
+
+            return;
+        }
+
+        // Let the broadphase pair up the finite objects.
+        switch (m_broadphaseMode)
+        {
+            case BroadphaseMode::UniformGrid:
+                m_grid.findPairs (m_proxies, m_pairs);
+                break;
+
+            case BroadphaseMode::SweepAndPrune:
+                m_sweepAndPrune.findPairs (m_proxies, m_pairs);
+                break;
+
+            case BroadphaseMode::AABBTree:
+                m_tree.findPairs (m_proxies, m_pairs);
+                break;
+
+            default:
+                assert (false);
+                break;
+        }
+
+        // Infinite objects could collide with anything so they are always tested.
+        for (auto i = 0U; i < m_infinite.size(); ++i)
+        {
+            const auto& infinite = *m_live[m_infinite[i]];
+
+            // Start with the other infinite objects so that each pair is only output once.
+            for (auto j = i + 1; j < m_infinite.size(); ++j)
+            {
+                if (!isResting (infinite) || !isResting (*m_live[m_infinite[j]]))
+                {
+                    BroadphasePair pair { };
+                    pair.lhs = m_infinite[i];
+                    pair.rhs = m_infinite[j];
+                    m_pairs.push_back (pair);
+                }
+            }
+
+            for (const auto& proxy : m_proxies)
+            {
+                if (!isResting (infinite) || !proxy.isStatic)
+                {
+                    BroadphasePair pair { };
+                    pair.lhs = m_infinite[i];
+                    pair.rhs = proxy.index;
+                    m_pairs.push_back (pair);
+                }
+            }
+        }
+    }
+
+
+    void PhysicsSystem::queryIndices (const AABB& bounds, std::vector<unsigned int>& indices) const
+    {
+        // The tree and grid can answer without looking at every object.
+        switch (m_queryMode)
+        {
+            case BroadphaseMode::AABBTree:
+                m_tree.query (bounds, indices);
+                break;
+
+            case BroadphaseMode::UniformGrid:
+                m_grid.query (bounds, m_proxies, indices);
+                break;
+
+            default:
+                for (const auto& proxy : m_proxies)
+                {
+                    if (proxy.bounds.overlaps (bounds))
+                    {
+                        indices.push_back (proxy.index);
+                    }
+                }
+        }
+    }
+
+
+    bool PhysicsSystem::applyRadialImpulses()
+    {
+        auto& bodies    = m_bodies;
+        auto woken      = false;
+
+        for (const auto& impulse : m_impulses)
+        {
+            // Only objects whose bounds reach into the box around the blast need their distance checked.
+            m_queryResults.clear();
+            queryIndices (AABB::fromCentre (impulse.centre, { impulse.radius, impulse.radius, impulse.radius }), m_queryResults);
+
+            for (const auto index : m_queryResults)
+            {
+                const auto body = m_live[index]->m_body;
+
+                // IDs start at 1 so an impulse without a source never matches.
+                if ((bodies.flags[body] & (BodyStore::Static | BodyStore::Attached)) != BodyStore::Attached ||
+                    m_live[index]->getID() == impulse.source)
+                {
+                    continue;
+                }
+
+                const auto offset   = m_colliders[index].centre - impulse.centre;
+                const auto distance = math::length (offset);
+
+                if (distance >= impulse.radius)
+                {
+                    continue;
+                }
+
+                // An object exactly at the centre has no direction to be pushed in, so it's thrown upwards.
+                const auto direction = distance > 1e-4f ? offset / distance : math::Vector3 (0.f, 1.f, 0.f);
+                const auto fraction  = 1.f - distance / impulse.radius;
+
+                auto scale = 1.f;
+
+                switch (impulse.falloff)
+                {
+                    case Falloff::Linear:
+                        scale = fraction;
+                        break;
+
+                    case Falloff::Quadratic:
+                        scale = fraction * fraction;
+                        break;
+
+                    default:
+                        break;
+                }
+
+                const auto deltaV = direction * (impulse.strength * scale * bodies.inverseMass[body]);
+
+                bodies.velocityX[body] += deltaV.x;
+                bodies.velocityY[body] += deltaV.y;
+                bodies.velocityZ[body] += deltaV.z;
+
+                if (bodies.hasFlag (body, BodyStore::Sleeping))
+                {
+                    wake (body);
+                    woken = true;
+                }
+            }
+        }
+
+        m_impulses.clear();
+
+        return woken;
+    }
+
+
+    void PhysicsSystem::sortPairs()
+    {
+        // Pairs are bucketed by combination, with one extra bucket at the end for pairs which can't collide.
+        const auto typeCount = static_cast<unsigned int> (PhysicsObject::Type::Count);
+        const auto skipped   = typeCount * typeCount;
+        
+        std::array<unsigned int, skipped + 1> offsets { };
+
+        const auto combination = [=] (BroadphasePair& pair)
+        {
+            const auto& lhs = m_colliders[pair.lhs];
+            const auto& rhs = m_colliders[pair.rhs];
+
+            if (!lhs.attached || !rhs.attached)
+            {
+                return skipped;
+            }
+
+            if (!CollisionDetection::isCanonical (lhs.type, rhs.type))
+            {
+                std::swap (pair.lhs, pair.rhs);
+                return static_cast<unsigned int> (rhs.type) * typeCount + static_cast<unsigned int> (lhs.type);
+            }
+
+            return static_cast<unsigned int> (lhs.type) * typeCount + static_cast<unsigned int> (rhs.type);
+        };
+
+        // A counting sort keeps the pairs of each combination in the order they were found, so it's deterministic.
+        for (auto& pair : m_pairs)
+        {
+            ++offsets[combination (pair)];
+        }
+
+        auto begin = 0U;
+
+        for (auto& offset : offsets)
+        {
+            const auto count = offset;
+            offset           = begin;
+            begin           += count;
+        }
+
+        m_sortedPairs.resize (m_pairs.size());
+
+        for (const auto& pair : m_pairs)
+        {
+            // The pairs were swapped into canonical order above so this won't swap them back.
+            auto copy = pair;
+            m_sortedPairs[offsets[combination (copy)]++] = copy;
+        }
+
+        m_pairs.swap (m_sortedPairs);
+
+        // Each offset is now the end of its bucket, cut every bucket into chunks.
+        const auto chunkSize = 64U;
+        m_chunkCount         = 0;
+        begin                = 0;
+
+        for (auto bucket = 0U; bucket < skipped; ++bucket)
+        {
+            const auto handler = CollisionDetection::getHandler (static_cast<PhysicsObject::Type> (bucket / typeCount), 
+                                                                 static_cast<PhysicsObject::Type> (bucket % typeCount));
+
+            for (auto first = begin; first < offsets[bucket]; first += chunkSize)
+            {
+                if (m_chunks.size() <= m_chunkCount)
+                {
+                    m_chunks.resize (m_chunkCount + 1);
+                }
+
+                auto& chunk   = m_chunks[m_chunkCount++];
+                chunk.begin   = first;
+                chunk.end     = std::min (first + chunkSize, offsets[bucket]);
+                chunk.handler = handler;
+            }
+
+            begin = offsets[bucket];
+        }
     }
-} 
+}
\ No newline at end of file
@@ -3,14 +3,33 @@
 
 
 // STL headers.
+#include <cstdint>
 #include <memory>
+#include <random>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 
-// Engine headers.
-#include <tyga/Math.hpp>
-#include <tyga/RunloopTaskProtocol.hpp>
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/BodyStore.hpp>
+#include <Physics/Broadphase.hpp>
+#include <Physics/Collider.hpp>
+#include <Physics/CollisionDetection.hpp>
+#include <Physics/Contact.hpp>
+#include <Physics/ContactCache.hpp>
+#include <Physics/ContactSolver.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/ForceGenerator.hpp>
+#include <Physics/IslandBuilder.hpp>
+#include <Physics/ObjectRegistry.hpp>
+#include <Physics/ParticleSystem.hpp>
+#include <Physics/SweepAndPrune.hpp>
+#include <Physics/TreeBroadphase.hpp>
+#include <Physics/UniformGrid.hpp>
+#include <Utility/PoolAllocator.hpp>
+#include <Utility/ThreadPool.hpp>
 
 
 namespace spc
@@ -21,12 +40,35 @@ namespace spc
     
     /// <summary>
     /// A physics simulation system which aims to reproduce realistic looking physics with multiple types
-    /// of collision detection available.
+    /// of collision detection available. The state of every body is owned by the system in a BodyStore.
     /// </summary>
-    class PhysicsSystem final : public tyga::RunloopTaskProtocol
+    class PhysicsSystem final : public EngineTask
     {
         public:           
 
+            /// <summary>
+            /// The algorithm used to find pairs of objects which could be colliding.
+            /// </summary>
+            enum class BroadphaseMode : int
+            {
+                BruteForce      = 0,    //!< Every object is tested against every other object.
+                UniformGrid     = 1,    //!< Objects are binned into a spatial hash and only neighbours are tested.
+                SweepAndPrune   = 2,    //!< Objects are kept sorted on each axis and swept for overlaps, best for mostly resting scenes.
+                AABBTree        = 3     //!< Objects are stored in dynamic bounding volume hierarchies, best for long-lived objects.
+            };
+
+
+            /// <summary>
+            /// How the strength of a radial impulse fades between its centre and its radius.
+            /// </summary>
+            enum class Falloff : int
+            {
+                Constant    = 0,    //!< Every object within the radius receives the full strength.
+                Linear      = 1,    //!< The strength fades linearly to zero at the radius.
+                Quadratic   = 2     //!< The strength fades with the square of the distance, concentrating it near the centre.
+            };
+
+
             /////////////////////////////////
             // Constructors and destructor //
             /////////////////////////////////
@@ -38,9 +80,9 @@ namespace spc
             PhysicsSystem (PhysicsSystem&& move);
             PhysicsSystem& operator= (PhysicsSystem&& move);
 
-            PhysicsSystem (const PhysicsSystem& copy)               = default;
-            PhysicsSystem& operator= (const PhysicsSystem& copy)    = default;
-            ~PhysicsSystem()                                        = default;
+            PhysicsSystem (const PhysicsSystem& copy)               = delete;
+            PhysicsSystem& operator= (const PhysicsSystem& copy)    = delete;
+            ~PhysicsSystem();
 
 
             //////////////////////
@@ -51,7 +93,11 @@ namespace spc
             /// <returns> The default system. </returns>
             static std::shared_ptr<PhysicsSystem> defaultSystem();
             
-            /// <summary> Make a request for a new PhysicsObject to be created an registered with the system. </summary>
+            /// <summary> 
+            /// Make a request for a new PhysicsObject to be created an registered with the system. The object is allocated
+            /// from a pool owned by the system, so creating and destroying objects doesn't touch the heap once enough
+            /// blocks of its size exist.
+            /// </summary>
             /// <param name="T"> The type of object to create, this will fail if it does not inherit from PhysicsObject. </param>
             /// <returns> A pointer to the specified descendant of PhysicsObject. </returns>
             template <typename T> 
@@ -60,14 +106,282 @@ namespace spc
 
             /// <summary> Gets the vector containing the acceleration applied to every object each frame. <summary>
             /// <returns> The gravity to be applied. </returns>
-            const tyga::Vector3& getGravity() const         { return m_gravity; }
+            const math::Vector3& getGravity() const         { return m_gravity; }
 
             /// <summary> Sets the gravity value that will be applied to every object each frame. </summary>
             /// <param name="gravity"> The new gravity value. </param>
-            void setGravity (const tyga::Vector3& gravity)  { m_gravity = gravity; }
+            void setGravity (const math::Vector3& gravity)  { m_gravity = gravity; }
+
+            /// <summary> Gets the algorithm used to find potentially colliding pairs. </summary>
+            /// <returns> The current broadphase mode. </returns>
+            BroadphaseMode getBroadphaseMode() const                { return m_broadphaseMode; }
+
+            /// <summary> Sets the algorithm used to find potentially colliding pairs. </summary>
+            /// <param name="mode"> The new broadphase mode. </param>
+            void setBroadphaseMode (const BroadphaseMode mode)      { m_broadphaseMode = mode; }
+
+            /// <summary> Gets the cell size used by the uniform grid broadphase. </summary>
+            /// <returns> The width of each cell. </returns>
+            float getCellSize() const                               { return m_grid.getCellSize(); }
+
+            /// <summary> Sets the cell size used by the uniform grid, this should be close to the diameter of common objects. </summary>
+            /// <param name="cellSize"> The new width of each cell, values of zero or below will be ignored. </param>
+            void setCellSize (const float cellSize)                 { m_grid.setCellSize (cellSize); }
+
+            /// <summary> Gets how much the bounds of each object are fattened by in the AABB tree broadphase. </summary>
+            /// <returns> The margin. </returns>
+            float getTreeMargin() const                             { return m_tree.getMargin(); }
+
+            /// <summary> Sets how much the bounds of each object are fattened by in the AABB tree broadphase. </summary>
+            /// <param name="margin"> The new margin, values below zero will be ignored. </param>
+            void setTreeMargin (const float margin)                 { m_tree.setMargin (margin); }
+
+            /// <summary> Gets whether the simulation advances in steps of a fixed size rather than by the frame time. </summary>
+            /// <returns> Whether a fixed timestep is used. </returns>
+            bool isFixedTimestep() const                            { return m_fixedTimestep; }
+
+            /// <summary> 
+            /// Sets whether the simulation advances in steps of a fixed size. When enabled the frame time is accumulated
+            /// and as many substeps as fit are simulated, up to the maximum substep count.
+            /// </summary>
+            /// <param name="fixedTimestep"> Whether a fixed timestep should be used. </param>
+            void setFixedTimestep (const bool fixedTimestep);
+
+            /// <summary> Gets the length of each substep when using a fixed timestep. </summary>
+            /// <returns> The substep size in seconds. </returns>
+            float getSubstepSize() const                            { return m_substepSize; }
+
+            /// <summary> Sets the length of each substep when using a fixed timestep. </summary>
+            /// <param name="substepSize"> The new size in seconds, values of zero or below will be ignored. </param>
+            void setSubstepSize (const float substepSize);
+
+            /// <summary> Gets the most substeps which will be simulated in a single frame. </summary>
+            /// <returns> The maximum substep count. </returns>
+            unsigned int getMaxSubsteps() const                     { return m_maxSubsteps; }
+
+            /// <summary> 
+            /// Sets the most substeps which will be simulated in a single frame. Any time which would require more
+            /// substeps is discarded, slowing the simulation down rather than letting it fall further behind.
+            /// </summary>
+            /// <param name="maxSubsteps"> The new maximum, zero will be ignored. </param>
+            void setMaxSubsteps (const unsigned int maxSubsteps);
+
+            /// <summary> Gets whether every run given the same inputs produces bitwise identical results. </summary>
+            /// <returns> Whether deterministic mode is enabled. </returns>
+            bool isDeterministic() const                            { return m_deterministic; }
+
+            /// <summary>
+            /// Sets whether every run given the same inputs produces bitwise identical results, for replaying recorded
+            /// sessions. Objects are processed in the order they were created rather than the order of the registry,
+            /// each tick simulates exactly getSubstepsPerTick() substeps whatever the frame time was and a hash of the
+            /// state of every body is taken after each tick. The library must also be built with strict floating point
+            /// settings, which the project files use.
+            /// </summary>
+            /// <param name="deterministic"> Whether deterministic mode should be enabled. </param>
+            void setDeterministic (const bool deterministic);
+
+            /// <summary> Gets how many substeps each tick simulates in deterministic mode. </summary>
+            /// <returns> The number of substeps per tick. </returns>
+            unsigned int getSubstepsPerTick() const                 { return m_tickSubsteps; }
+
+            /// <summary> Sets how many substeps each tick simulates in deterministic mode, e.g. 2 for 120Hz steps at 60 ticks a second. </summary>
+            /// <param name="substeps"> The new number of substeps, zero will be ignored. </param>
+            void setSubstepsPerTick (const unsigned int substeps);
+
+            /// <summary> 
+            /// Gets a hash of the position, velocity and state of every body in creation order, taken at the end of the
+            /// most recent tick in deterministic mode. Two runs are in step for as long as their hashes match.
+            /// </summary>
+            /// <returns> The hash, or zero if no tick has been simulated in deterministic mode. </returns>
+            std::uint64_t getStateHash() const                      { return m_stateHash; }
+
+            /// <summary> Gets how many ticks have been simulated since deterministic mode was enabled. </summary>
+            /// <returns> The number of ticks. </returns>
+            std::uint64_t getTickCount() const                      { return m_tickCount; }
+
+            /// <summary> 
+            /// Gets the random number generator of the scene. Games should draw every random value which affects the
+            /// simulation from here so a replay only needs the seed.
+            /// </summary>
+            /// <returns> The generator, seeded with getSeed(). </returns>
+            std::minstd_rand& getRandom()                           { return m_random; }
+
+            /// <summary> Gets the seed the random number generator was last given. </summary>
+            /// <returns> The seed. </returns>
+            unsigned int getSeed() const                            { return m_seed; }
+
+            /// <summary> Restarts the random number generator from the given seed. </summary>
+            /// <param name="seed"> The new seed. </param>
+            void setSeed (const unsigned int seed);
+
+            /// <summary> Gets how many times the contact solver visits every contact each step. </summary>
+            /// <returns> The number of solver iterations. </returns>
+            unsigned int getSolverIterations() const                { return m_solver.getIterations(); }
+
+            /// <summary> Sets how many times the contact solver visits every contact each step, more gives stiffer stacks. </summary>
+            /// <param name="iterations"> The number of iterations, zero will be ignored. </param>
+            void setSolverIterations (const unsigned int iterations) { m_solver.setIterations (iterations); }
+
+            /// <summary> Gets how the contact solver removes penetration between objects. </summary>
+            /// <returns> The position correction method. </returns>
+            ContactSolver::PositionCorrection getPositionCorrection() const             { return m_solver.getPositionCorrection(); }
+
+            /// <summary> Sets how the contact solver removes penetration between objects. </summary>
+            /// <param name="correction"> Baumgarte stabilisation or split impulses. </param>
+            void setPositionCorrection (const ContactSolver::PositionCorrection correction) { m_solver.setPositionCorrection (correction); }
+
+            /// <summary> Gets whether the contact solver starts from the impulses of the previous step. </summary>
+            /// <returns> Whether warm starting is enabled. </returns>
+            bool isWarmStarting() const                             { return m_solver.isWarmStarting(); }
+
+            /// <summary> Sets whether the contact solver starts from the impulses of the previous step. </summary>
+            /// <param name="warmStarting"> Whether to enable warm starting. </param>
+            void setWarmStarting (const bool warmStarting)          { m_solver.setWarmStarting (warmStarting); }
+
+            /// <summary> Gets how many threads help the runloop thread to simulate the scene. </summary>
+            /// <returns> The number of worker threads. </returns>
+            unsigned int getWorkerCount() const                     { return m_pool.getWorkerCount(); }
+
+            /// <summary> 
+            /// Sets how many threads help the runloop thread to simulate the scene. The results of the simulation
+            /// are identical regardless of the number of workers.
+            /// </summary>
+            /// <param name="workerCount"> The number of worker threads, zero runs everything on the runloop thread. </param>
+            void setWorkerCount (const unsigned int workerCount)    { m_pool.setWorkerCount (workerCount); }
+
+            /// <summary> Gets whether bodies which come to rest stop being simulated until something disturbs them. </summary>
+            /// <returns> Whether sleeping is enabled. </returns>
+            bool isSleepingEnabled() const                          { return m_sleeping; }
+
+            /// <summary> Sets whether bodies which come to rest stop being simulated, disabling it wakes every body. </summary>
+            /// <param name="sleeping"> Whether sleeping should be enabled. </param>
+            void setSleepingEnabled (const bool sleeping);
+
+            /// <summary> Gets the speed below which a body is considered to be resting. </summary>
+            /// <returns> The sleep velocity in metres per second. </returns>
+            float getSleepVelocity() const                          { return m_sleepVelocity; }
+
+            /// <summary> Sets the speed below which a body is considered to be resting. </summary>
+            /// <param name="velocity"> The new speed in metres per second, values below zero will be ignored. </param>
+            void setSleepVelocity (const float velocity);
+
+            /// <summary> Gets how long every body in an island must rest before the island falls asleep. </summary>
+            /// <returns> The time in seconds. </returns>
+            float getTimeToSleep() const                            { return m_timeToSleep; }
+
+            /// <summary> Sets how long every body in an island must rest before the island falls asleep. </summary>
+            /// <param name="time"> The new time in seconds, values of zero or below will be ignored. </param>
+            void setTimeToSleep (const float time);
+
+            /// <summary> 
+            /// Gets how far between the previous and current state of each body the frame is, for use in rendering.
+            /// This is always 1 when not using a fixed timestep.
+            /// </summary>
+            /// <returns> A value from 0 to 1. </returns>
+            float getInterpolationAlpha() const                     { return m_alpha; }
+
+            /// <summary> Gets how many objects currently exist in the system. </summary>
+            /// <returns> The number of registered objects. </returns>
+            unsigned int getObjectCount() const                     { return m_registry.size(); }
+
+            /// <summary> Checks whether a handle refers to an object which still exists, without locking it. </summary>
+            /// <param name="handle"> The handle given to the object on creation. </param>
+            /// <returns> Whether the object exists. </returns>
+            bool isValid (const ObjectHandle handle) const          { return m_registry.isValid (handle); }
+
+            /// <summary> Obtains the object referred to by a handle. </summary>
+            /// <param name="handle"> The handle given to the object on creation. </param>
+            /// <returns> The object, or nullptr if it has been destroyed. </returns>
+            std::shared_ptr<PhysicsObject> getObject (const ObjectHandle handle) const  { return m_registry.lock (handle); }
+
+            /// <summary> Gets how many blocks of each size the object pool has and how many are in use. </summary>
+            /// <returns> The occupancy of the pool for each size of object created so far. </returns>
+            std::vector<util::PoolResource::Stats> getObjectPoolStats() const  { return m_objectPool->getStats(); }
+
+            /// <summary> Gets the particles of the scene, which are stepped alongside every object. </summary>
+            /// <returns> The particle system used to create emitters. </returns>
+            ParticleSystem& getParticles()                          { return m_particles; }
+
+            /// <summary> Gets the particles of the scene, which are stepped alongside every object. </summary>
+            /// <returns> The particle system of the scene. </returns>
+            const ParticleSystem& getParticles() const              { return m_particles; }
+
+            /// <summary> 
+            /// Finds every finite object whose bounds overlap the given box as of the most recent collision detection
+            /// pass. Infinite objects such as planes and objects which aren't attached are not included.
+            /// </summary>
+            /// <param name="bounds"> The area to search. </param>
+            /// <param name="results"> The vector to append each object found to. </param>
+            void query (const AABB& bounds, std::vector<std::shared_ptr<PhysicsObject>>& results) const;
+
+            /// <summary>
+            /// Queues an impulse which pushes every moving object within a radius directly away from a point, e.g. the
+            /// blast of an explosion. Any number can be queued, they're applied together at the start of the next tick
+            /// using the broadphase to find the objects each one reaches. Sleeping objects which are pushed are woken.
+            /// </summary>
+            /// <param name="centre"> The world position the impulse pushes away from. </param>
+            /// <param name="radius"> How far the impulse reaches, values of zero or below will be ignored. </param>
+            /// <param name="strength"> The impulse in newton seconds given to an object at the centre. </param>
+            /// <param name="falloff"> How the strength fades with distance from the centre. </param>
+            /// <param name="source"> An object causing the impulse which shouldn't be pushed by it, e.g. a bomb, or nullptr. </param>
+            void applyRadialImpulse (const math::Vector3& centre, const float radius, const float strength,
+                const Falloff falloff = Falloff::Linear, const PhysicsObject* const source = nullptr);
+
+            /// <summary> Gets how many radial impulses are waiting to be applied at the start of the next tick. </summary>
+            /// <returns> The number of queued impulses. </returns>
+            unsigned int getQueuedImpulseCount() const              { return static_cast<unsigned int> (m_impulses.size()); }
+
+            /// <summary>
+            /// Adds a field to the end of the chain of force generators. Every generator is evaluated once per step, in
+            /// the order they were added, over each range of bodies before it's integrated. The gravity of the system
+            /// and the drag of each object are applied by the integrator and aren't part of the chain. Sleeping bodies
+            /// aren't simulated, so any which the field would push as it's added are woken.
+            /// </summary>
+            /// <param name="generator"> The generator to add, nullptr or a generator already in the chain will be ignored. </param>
+            void addForceGenerator (const std::shared_ptr<ForceGenerator>& generator);
+
+            /// <summary> Removes a field from the chain of force generators, the order of the others is kept. </summary>
+            /// <param name="generator"> The generator to remove. </param>
+            /// <returns> Whether the generator was in the chain. </returns>
+            bool removeForceGenerator (const std::shared_ptr<ForceGenerator>& generator);
+
+            /// <summary> Gets how many force generators are in the chain. </summary>
+            /// <returns> The number of generators. </returns>
+            unsigned int getForceGeneratorCount() const             { return static_cast<unsigned int> (m_forces.size()); }
 
         private:
 
+            // Objects are handles into m_bodies.
+            friend class PhysicsObject;
+
+
+            /// <summary>
+            /// A radial impulse queued by applyRadialImpulse.
+            /// </summary>
+            struct RadialImpulse final
+            {
+                math::Vector3   centre      { };                    //!< The world position the impulse pushes away from.
+                float           radius      { 0.f };                //!< How far the impulse reaches.
+                float           strength    { 0.f };                //!< The impulse given to an object at the centre.
+                Falloff         falloff     { Falloff::Linear };    //!< How the strength fades with distance.
+                unsigned int    source      { 0 };                  //!< The ID of the object causing the impulse, which isn't pushed, or 0.
+            };
+
+
+            /// <summary>
+            /// A range of pairs with the same combination of types and the results of testing them in the narrowphase, kept
+            /// separate so chunks can run in parallel.
+            /// </summary>
+            struct NarrowphaseChunk final
+            {
+                unsigned int                                            begin       { 0 };          //!< The index of the first pair in m_pairs.
+                unsigned int                                            end         { 0 };          //!< One past the index of the last pair.
+                CollisionDetection::Handler                             handler     { nullptr };    //!< Tests every pair in the chunk.
+                std::vector<ContactManifold>                            manifolds   { };            //!< A manifold for every pair which collided.
+                std::vector<std::pair<std::uint64_t, math::Vector3>>    separations { };            //!< The key and separating axis of every pair which didn't.
+            };
+
+
             //////////////////////////////
             // Delegate implementations //
             //////////////////////////////
@@ -82,14 +396,207 @@ namespace spc
             void runloopDidEnd() override final;
 
 
+            //////////////////////
+            // Actor management //
+            //////////////////////
+
+            /// <summary> Locks every registered object into m_live, in creation order when deterministic. </summary>
+            void lockObjects();
+
+            /// <summary> Hashes the bit patterns of the ID, position, velocity and flags of every living body. </summary>
+            /// <returns> A 64-bit FNV-1a hash. </returns>
+            std::uint64_t hashState() const;
+
+            /// <summary> Copies the transformation of every Actor into the BodyStore, this is done once at the start of each tick. </summary>
+            void syncFromActors();
+
+            /// <summary> Writes the simulated position of every moving body back to its Actor in a single pass. </summary>
+            void syncToActors();
+
+
+            ////////////////
+            // Simulation //
+            ////////////////
+
+            /// <summary> Detects collisions and then integrates every body once. </summary>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            void step (const float deltaTime);
+
+            /// <summary> 
+            /// Runs the narrowphase over chunks of pairs in parallel without modifying any object, filling m_manifolds
+            /// with a manifold for every colliding pair in the order of m_pairs after sorting. Pairs which a cached axis
+            /// still separates are skipped, and the axis of every pair which didn't collide is cached for next step.
+            /// </summary>
+            void detectContacts();
+
+            /// <summary> 
+            /// Splits the manifolds into islands and solves them with the ContactSolver. Islands are solved in
+            /// parallel whilst the manifolds within an island are solved in order, so the result doesn't depend on
+            /// the thread count.
+            /// </summary>
+            /// <param name="deltaTime"> The length of the step. </param>
+            void resolveContacts (const float deltaTime);
+
+            /// <summary> Wakes every sleeping body which an awake body is touching, along with the rest of its island. </summary>
+            void wakeTouched();
+
+            /// <summary> 
+            /// Puts islands whose bodies have all rested for long enough to sleep. Bodies without any contacts are
+            /// treated as an island of their own.
+            /// </summary>
+            /// <param name="deltaTime"> The length of the step. </param>
+            void updateSleep (const float deltaTime);
+
+            /// <summary> Triggers the collision events of every pair which collided, in the order the pairs were found. </summary>
+            void triggerCollisionEvents();
+
+            /// <summary> Moves every simulated body using the batched Runge-Kutta integrator and resets applied forces. </summary>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            void integrate (const float deltaTime);
+
+            /// <summary>
+            /// Decides which bodies in a contiguous range are simulated this step and adds the force of every generator to
+            /// them. Every range is processed before any is integrated so generators linking bodies see consistent state.
+            /// </summary>
+            /// <param name="first"> The index of the first body. </param>
+            /// <param name="last"> One past the index of the last body. </param>
+            void accumulateForces (const unsigned int first, const unsigned int last);
+
+            /// <summary> Integrates a contiguous range of bodies, ranges are processed in parallel. </summary>
+            /// <param name="first"> The index of the first body. </param>
+            /// <param name="last"> One past the index of the last body. </param>
+            /// <param name="deltaTime"> How many seconds to simulate. </param>
+            void integrateRange (const unsigned int first, const unsigned int last, const float deltaTime);
+
+            /// <summary> 
+            /// Sweeps every continuous sphere from its previous position to its integrated position against planes and
+            /// other spheres. At the earliest impact the sphere is stopped, bounced off what it hit and swept along its
+            /// new velocity for the rest of the step, so fast objects can't pass through anything between steps. Only
+            /// objects the broadphase finds near the path of the sphere are tested.
+            /// </summary>
+            /// <param name="deltaTime"> How many seconds were simulated. </param>
+            void sweepContinuous (const float deltaTime);
+
+
+            //////////////
+            // Sleeping //
+            //////////////
+
+            /// <summary> Wakes a body, the rest of the island it fell asleep with is woken by the next call to wakeGroups. </summary>
+            /// <param name="body"> The index of the body in m_bodies. </param>
+            void wake (const unsigned int body);
+
+            /// <summary> Wakes every body which fell asleep in the same island as a body woken since the last call. </summary>
+            void wakeGroups();
+
+            /// <summary> 
+            /// Sleeping bodies aren't paired with static bodies, so any which a static body was moved into by the game
+            /// would never notice. This wakes them instead.
+            /// </summary>
+            void wakeAroundMovedStatics();
+
+            /// <summary> 
+            /// Evaluates a force generator over every sleeping body as if it were awake and wakes each one it pushes.
+            /// Fields such as drag give no force to a body at rest, so only the bodies the field actually moves wake.
+            /// </summary>
+            /// <param name="generator"> The generator to evaluate, its forces are discarded. </param>
+            void wakeForcedBodies (const ForceGenerator& generator);
+
+
+            ////////////////////
+            // Pair detection //
+            ////////////////////
+
+            /// <summary> 
+            /// Fills m_colliders with the world space shape of every object in m_live, in parallel. This must be done
+            /// whenever objects have moved before they are paired or tested.
+            /// </summary>
+            void buildColliders();
+
+            /// <summary> 
+            /// Fills m_pairs with every pair which could be colliding this tick using the current broadphase mode. 
+            /// Infinite objects such as planes are always paired with every other object. 
+            /// </summary>
+            void findPairs();
+
+            /// <summary> Finds every finite object whose bounds overlap the given box using the most recent broadphase. </summary>
+            /// <param name="bounds"> The area to search. </param>
+            /// <param name="indices"> The vector to append the index in m_live of each object found to. </param>
+            void queryIndices (const AABB& bounds, std::vector<unsigned int>& indices) const;
+
+            /// <summary> 
+            /// Applies every queued radial impulse to the velocity of the objects it reaches and clears the queue. This
+            /// must be done after the pairs of the tick have been found.
+            /// </summary>
+            /// <returns> Whether any sleeping objects were woken, in which case the pairs must be found again. </returns>
+            bool applyRadialImpulses();
+
+            /// <summary> 
+            /// Stably sorts m_pairs by the combination of types of each pair, swapping the objects of a pair when needed so
+            /// the collision handler can be called without swapping them back. Each combination is then cut into chunks
+            /// for the narrowphase, so every chunk calls a single handler. Pairs with an unattached object are moved to
+            /// the end and left out of every chunk as they can never collide.
+            /// </summary>
+            void sortPairs();
+
+
             ///////////////////
             // Internal data //
             ///////////////////
 
             static std::shared_ptr<PhysicsSystem>       m_defaultSystem;    //!< The default system to use be used by games.
             
-            tyga::Vector3                               m_gravity   { };    //!< The gravity to apply to every PhysicsObject. Defaults to earths gravity.
-            std::vector<std::weak_ptr<PhysicsObject>>   m_objects   { };    //!< A collection of every PhysicsObject in the scene.
+            math::Vector3                               m_gravity        { };                              //!< The gravity to apply to every PhysicsObject. Defaults to earths gravity.
+            ObjectRegistry                              m_registry       { };                              //!< Every PhysicsObject in the scene, objects unregister themselves on destruction.
+            BodyStore                                   m_bodies         { };                              //!< The simulation state of every PhysicsObject.
+            std::vector<float>                          m_motion         { };                              //!< 1 for each body being integrated this tick, 0 otherwise.
+            std::vector<std::shared_ptr<ForceGenerator>> m_forces        { };                              //!< The chain of force generators, evaluated in order.
+
+            bool                                        m_fixedTimestep  { false };                        //!< Whether the simulation advances in fixed size substeps.
+            float                                       m_substepSize    { 1.f / 120.f };                  //!< The length of each substep in seconds.
+            unsigned int                                m_maxSubsteps    { 8 };                            //!< The most substeps to simulate in one frame.
+            float                                       m_accumulator    { 0.f };                          //!< Frame time which hasn't been simulated yet.
+            float                                       m_alpha          { 1.f };                          //!< How far between the previous and current state the frame is.
+
+            bool                                        m_deterministic  { false };                        //!< Whether runs must be bitwise reproducible.
+            unsigned int                                m_tickSubsteps   { 2 };                            //!< How many substeps each tick simulates when deterministic.
+            std::uint64_t                               m_stateHash      { 0 };                            //!< The hash of every body at the end of the last deterministic tick.
+            std::uint64_t                               m_tickCount      { 0 };                            //!< How many deterministic ticks have been simulated.
+            unsigned int                                m_seed           { 1 };                            //!< The seed last given to m_random.
+            std::minstd_rand                            m_random         { 1 };                            //!< The random number generator of the scene.
+
+            bool                                        m_sleeping       { true };                         //!< Whether resting bodies are put to sleep.
+            float                                       m_sleepVelocity  { 0.05f };                        //!< The speed below which a body is resting.
+            float                                       m_timeToSleep    { 0.5f };                         //!< How long an island must rest before sleeping.
+            std::vector<std::uint8_t>                   m_sleepReady     { };                              //!< Whether each body may fall asleep at the end of this step.
+            std::vector<unsigned int>                   m_wakeGroups     { };                              //!< The sleep groups of bodies woken since the groups were last woken.
+            std::vector<unsigned int>                   m_movedStatics   { };                              //!< Static bodies which the game moved this tick.
+
+            BroadphaseMode                              m_broadphaseMode { BroadphaseMode::UniformGrid };  //!< The algorithm used to find potential pairs.
+            BroadphaseMode                              m_queryMode      { BroadphaseMode::BruteForce };   //!< The broadphase which was used in the most recent tick.
+            UniformGrid                                 m_grid           { };                              //!< The spatial hash used by BroadphaseMode::UniformGrid.
+            SweepAndPrune                               m_sweepAndPrune  { };                              //!< The sorted axis lists used by BroadphaseMode::SweepAndPrune.
+            TreeBroadphase                              m_tree           { };                              //!< The bounding volume hierarchies used by BroadphaseMode::AABBTree.
+            unsigned int                                m_nextID         { 1 };                            //!< The ID to give to the next created object.
+            std::shared_ptr<util::PoolResource>         m_objectPool     { };                              //!< Where objects are allocated from, kept alive by every object allocated from it.
+            std::vector<std::shared_ptr<PhysicsObject>> m_live           { };                              //!< Every object locked once per tick, kept until the next tick so queries can be answered.
+            std::vector<Collider>                       m_colliders      { };                              //!< The world space shape of every object in m_live as of the start of the step.
+            std::vector<BroadphaseProxy>                m_proxies        { };                              //!< The bounds of every finite object in m_live.
+            std::vector<unsigned int>                   m_infinite       { };                              //!< Indices of objects in m_live which must always be tested, e.g. planes.
+            std::vector<RadialImpulse>                  m_impulses       { };                              //!< Radial impulses waiting to be applied at the start of the next tick.
+            std::vector<unsigned int>                   m_queryResults   { };                              //!< The objects found by each internal broadphase query, reused between queries.
+            std::vector<BroadphasePair>                 m_pairs          { };                              //!< Pairs of indices into m_live which may be colliding.
+            bool                                        m_pairsFound     { false };                        //!< Whether m_pairs is up to date with the current positions.
+            std::vector<BroadphasePair>                 m_sortedPairs    { };                              //!< Where m_pairs is sorted into before they're swapped.
+            std::vector<NarrowphaseChunk>               m_chunks         { };                              //!< The pairs and results of each chunk of the narrowphase, only grows so buffers are reused.
+            unsigned int                                m_chunkCount     { 0 };                            //!< How many of m_chunks are used this step.
+            std::vector<ContactManifold>                m_manifolds      { };                              //!< Every manifold found this step, in pair order.
+            std::vector<BroadphasePair>                 m_contactPairs   { };                              //!< The objects of each manifold, used to build islands.
+            IslandBuilder                               m_islands        { };                              //!< Groups m_manifolds into independent islands.
+            ContactCache                                m_contacts       { };                              //!< What was learnt about each pair last step, used by the narrowphase and solver.
+            ContactSolver                               m_solver         { };                              //!< Resolves every manifold using sequential impulses.
+            ParticleSystem                              m_particles      { };                              //!< Debris and effects which collide with the scene but don't affect it.
+            util::ThreadPool                            m_pool           { };                              //!< The threads which islands and integration are spread across.
 
     };
 
@@ -102,11 +609,14 @@ namespace spc
     std::shared_ptr<typename std::enable_if<std::is_base_of<PhysicsObject, T>::value && !std::is_same<PhysicsObject, T>::value, T>::type>
     PhysicsSystem::createObject()
     {
-        // Create the new object.
-        const auto object = std::make_shared<T>();
+        // Create the new object, its reference count shares the same pooled block.
+        const auto object = std::allocate_shared<T> (util::PoolAllocator<T> (m_objectPool));
+        object->m_id      = m_nextID++;
+        object->m_system  = this;
+        object->m_body    = m_bodies.add (object.get());
 
-        // Add the new object to the vector.
-        m_objects.emplace_back (object);
+        // Register the new object.
+        object->m_handle  = m_registry.add (object);
 
         // Return the new object.
         return object;
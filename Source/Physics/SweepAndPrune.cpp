@@ -0,0 +1,273 @@
+#include "SweepAndPrune.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <utility>
+
+
+namespace spc
+{
+    /// <summary> Obtains a single component of a vector. </summary>
+    /// <param name="vector"> The vector to read from. </param>
+    /// <param name="axis"> 0 = X, 1 = Y and 2 = Z. </param>
+    /// <returns> The desired component. </returns>
+    static float component (const math::Vector3& vector, const unsigned int axis)
+    {
+        return axis == 0 ? vector.x : axis == 1 ? vector.y : vector.z;
+    }
+
+
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    SweepAndPrune::SweepAndPrune (SweepAndPrune&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    SweepAndPrune& SweepAndPrune::operator= (SweepAndPrune&& move)
+    {
+        if (this != &move)
+        {
+            for (auto i = 0U; i < 3; ++i)
+            {
+                m_axes[i] = std::move (move.m_axes[i]);
+            }
+
+            m_slots     = std::move (move.m_slots);
+            m_freeSlots = std::move (move.m_freeSlots);
+            m_active    = std::move (move.m_active);
+            m_idToSlot  = std::move (move.m_idToSlot);
+            m_update    = move.m_update;
+
+            move.m_update = 0;
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void SweepAndPrune::findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs)
+    {
+        ++m_update;
+
+        // Bring the tracked objects up to date.
+        updateSlots (proxies);
+        removeStaleSlots();
+
+        // Objects move very little between ticks so the lists will be almost sorted already.
+        for (auto axis = 0U; axis < 3; ++axis)
+        {
+            sortAxis (axis);
+        }
+
+        // Sweep along the axis, anything the sweep line is inside of overlaps on that axis.
+        const auto& endpoints = m_axes[chooseSweepAxis()];
+        m_active.clear();
+
+        for (const auto& endpoint : endpoints)
+        {
+            if (endpoint.isMin)
+            {
+                const auto& slot = m_slots[endpoint.slot];
+
+                // Confirm the overlap on the remaining axes.
+                for (const auto other : m_active)
+                {
+                    const auto& otherSlot = m_slots[other];
+
+                    // Don't check static on static collision.
+                    if ((!slot.isStatic || !otherSlot.isStatic) && slot.bounds.overlaps (otherSlot.bounds))
+                    {
+                        BroadphasePair pair { };
+                        pair.lhs = otherSlot.index;
+                        pair.rhs = slot.index;
+                        pairs.push_back (pair);
+                    }
+                }
+
+                m_active.push_back (endpoint.slot);
+            }
+
+            else
+            {
+                // The sweep line has left the object.
+                const auto active = std::find (m_active.begin(), m_active.end(), endpoint.slot);
+                *active = m_active.back();
+                m_active.pop_back();
+            }
+        }
+    }
+
+
+    /////////////////////
+    // Slot management //
+    /////////////////////
+
+    void SweepAndPrune::updateSlots (const std::vector<BroadphaseProxy>& proxies)
+    {
+        for (const auto& proxy : proxies)
+        {
+            const auto existing = m_idToSlot.find (proxy.id);
+            auto slotIndex      = 0U;
+
+            if (existing != m_idToSlot.end())
+            {
+                slotIndex = existing->second;
+            }
+
+            else
+            {
+                // Reuse a free slot where possible.
+                if (m_freeSlots.empty())
+                {
+                    slotIndex = static_cast<unsigned int> (m_slots.size());
+                    m_slots.emplace_back();
+                }
+
+                else
+                {
+                    slotIndex = m_freeSlots.back();
+                    m_freeSlots.pop_back();
+                }
+
+                m_idToSlot.emplace (proxy.id, slotIndex);
+                m_slots[slotIndex].isActive = true;
+
+                // Add the endpoints to the end of each axis, the next sort will move them into place.
+                for (auto& axis : m_axes)
+                {
+                    Endpoint endpoint { };
+                    endpoint.slot  = slotIndex;
+                    endpoint.isMin = true;
+                    axis.push_back (endpoint);
+
+                    endpoint.isMin = false;
+                    axis.push_back (endpoint);
+                }
+            }
+
+            auto& slot      = m_slots[slotIndex];
+            slot.bounds     = proxy.bounds;
+            slot.index      = proxy.index;
+            slot.isStatic   = proxy.isStatic;
+            slot.lastSeen   = m_update;
+        }
+    }
+
+
+    void SweepAndPrune::removeStaleSlots()
+    {
+        // The common case is that nothing has been removed.
+        const auto tracked = m_idToSlot.size();
+
+        for (auto it = m_idToSlot.begin(); it != m_idToSlot.end(); )
+        {
+            auto& slot = m_slots[it->second];
+
+            if (slot.lastSeen != m_update)
+            {
+                slot.isActive = false;
+                m_freeSlots.push_back (it->second);
+                it = m_idToSlot.erase (it);
+            }
+
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Stable removal keeps the lists sorted.
+        if (tracked != m_idToSlot.size())
+        {
+            for (auto& axis : m_axes)
+            {
+                const auto isStale = [this] (const Endpoint& endpoint) { return !m_slots[endpoint.slot].isActive; };
+                axis.erase (std::remove_if (axis.begin(), axis.end(), isStale), axis.end());
+            }
+        }
+    }
+
+
+    /////////////
+    // Sorting //
+    /////////////
+
+    void SweepAndPrune::sortAxis (const unsigned int axis)
+    {
+        auto& endpoints = m_axes[axis];
+
+        // Refresh the values from the latest bounds.
+        for (auto& endpoint : endpoints)
+        {
+            const auto& bounds = m_slots[endpoint.slot].bounds;
+            endpoint.value     = component (endpoint.isMin ? bounds.min : bounds.max, axis);
+        }
+
+        // Starts are placed before ends of equal value so that touching objects are considered overlapping.
+        const auto isLess = [] (const Endpoint& lhs, const Endpoint& rhs)
+        {
+            return lhs.value < rhs.value || (lhs.value == rhs.value && lhs.isMin && !rhs.isMin);
+        };
+
+        // Insertion sort is close to linear on nearly sorted data.
+        for (auto i = 1U; i < endpoints.size(); ++i)
+        {
+            const auto endpoint = endpoints[i];
+            auto j = i;
+
+            while (j > 0 && isLess (endpoint, endpoints[j - 1]))
+            {
+                endpoints[j] = endpoints[j - 1];
+                --j;
+            }
+
+            endpoints[j] = endpoint;
+        }
+    }
+
+
+    unsigned int SweepAndPrune::chooseSweepAxis() const
+    {
+        // Calculate the variance of the centre of each object on every axis.
+        float sum[3] { }, sumSqr[3] { };
+
+        for (const auto& slot : m_slots)
+        {
+            if (slot.isActive)
+            {
+                for (auto axis = 0U; axis < 3; ++axis)
+                {
+                    const auto centre = (component (slot.bounds.min, axis) + component (slot.bounds.max, axis)) * 0.5f;
+                    sum[axis]    += centre;
+                    sumSqr[axis] += centre * centre;
+                }
+            }
+        }
+
+        const auto count = static_cast<float> (std::max<std::size_t> (m_idToSlot.size(), 1));
+        auto best        = 0U;
+        auto bestSpread  = -1.f;
+
+        for (auto axis = 0U; axis < 3; ++axis)
+        {
+            const auto spread = sumSqr[axis] - sum[axis] * sum[axis] / count;
+
+            if (spread > bestSpread)
+            {
+                best       = axis;
+                bestSpread = spread;
+            }
+        }
+
+        return best;
+    }
+}
\ No newline at end of file
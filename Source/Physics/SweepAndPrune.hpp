@@ -0,0 +1,105 @@
+#ifndef SPC_SWEEP_AND_PRUNE_ASP_HPP
+#define SPC_SWEEP_AND_PRUNE_ASP_HPP
+
+
+// STL headers.
+#include <unordered_map>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Broadphase.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// An incremental sweep-and-prune broadphase. The start and end points of every object are kept sorted on each
+    /// axis across ticks, objects barely move between ticks so insertion sort restores the order in close to linear
+    /// time. A sweep along the most spread out axis then generates the pairs.
+    /// </summary>
+    class SweepAndPrune final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            SweepAndPrune()                                         = default;
+
+            SweepAndPrune (SweepAndPrune&& move);
+            SweepAndPrune& operator= (SweepAndPrune&& move);
+
+            SweepAndPrune (const SweepAndPrune& copy)               = default;
+            SweepAndPrune& operator= (const SweepAndPrune& copy)    = default;
+            ~SweepAndPrune()                                        = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary>
+            /// Updates the sorted lists with the given proxies and outputs each overlapping pair exactly once. Proxies
+            /// are tracked by their ID, any which were tracked last time but are missing now are removed.
+            /// </summary>
+            /// <param name="proxies"> The finite objects to test. </param>
+            /// <param name="pairs"> The vector to append potential pairs to. </param>
+            void findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs);
+
+        private:
+
+            /// <summary>
+            /// The start or end of an object on a single axis.
+            /// </summary>
+            struct Endpoint final
+            {
+                float           value   { 0.f };    //!< The position of the endpoint on the axis.
+                unsigned int    slot    { 0 };      //!< The slot of the object the endpoint belongs to.
+                bool            isMin   { false };  //!< Whether the endpoint is the start or the end of the object.
+            };
+
+            /// <summary>
+            /// The persistent information stored for each tracked object.
+            /// </summary>
+            struct Slot final
+            {
+                AABB            bounds      { };        //!< The bounds of the object this tick.
+                unsigned int    index       { 0 };      //!< The index of the object to output in pairs this tick.
+                unsigned int    lastSeen    { 0 };      //!< The last update the object was present in.
+                bool            isStatic    { false };  //!< Whether the object is static.
+                bool            isActive    { false };  //!< Whether the slot is in use.
+            };
+
+
+            /// <summary> Adds newly seen proxies and updates the bounds of the existing ones. </summary>
+            /// <param name="proxies"> The proxies given this update. </param>
+            void updateSlots (const std::vector<BroadphaseProxy>& proxies);
+
+            /// <summary> Removes every slot which wasn't given this update, along with its endpoints. </summary>
+            void removeStaleSlots();
+
+            /// <summary> Refreshes the values of every endpoint on an axis and restores their sorted order. </summary>
+            /// <param name="axis"> The axis to sort, 0 = X, 1 = Y and 2 = Z. </param>
+            void sortAxis (const unsigned int axis);
+
+            /// <summary> Chooses the axis where the objects are most spread out, this minimises false positives. </summary>
+            /// <returns> The axis to sweep along. </returns>
+            unsigned int chooseSweepAxis() const;
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<Endpoint>                           m_axes[3]   { };    //!< The sorted endpoints on each axis.
+            std::vector<Slot>                               m_slots     { };    //!< Every tracked object.
+            std::vector<unsigned int>                       m_freeSlots { };    //!< Slots which can be reused.
+            std::vector<unsigned int>                       m_active    { };    //!< The objects overlapping the sweep line.
+            std::unordered_map<unsigned int, unsigned int>  m_idToSlot  { };    //!< Maps the ID of each proxy to its slot.
+            unsigned int                                    m_update    { 0 };  //!< Incremented every update to detect stale slots.
+    };
+}
+
+#endif
\ No newline at end of file
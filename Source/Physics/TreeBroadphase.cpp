@@ -0,0 +1,111 @@
+#include "TreeBroadphase.hpp"
+
+
+// STL headers.
+#include <utility>
+
+
+namespace spc
+{
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    TreeBroadphase::TreeBroadphase (TreeBroadphase&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    TreeBroadphase& TreeBroadphase::operator= (TreeBroadphase&& move)
+    {
+        if (this != &move)
+        {
+            m_static    = std::move (move.m_static);
+            m_dynamic   = std::move (move.m_dynamic);
+            m_entries   = std::move (move.m_entries);
+            m_update    = move.m_update;
+
+            move.m_update = 0;
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void TreeBroadphase::setMargin (const float margin)
+    {
+        m_static.setMargin (margin);
+        m_dynamic.setMargin (margin);
+    }
+
+
+    void TreeBroadphase::findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs)
+    {
+        ++m_update;
+
+        // Bring each leaf up to date, most objects won't have escaped their fat bounds so this is cheap.
+        for (const auto& proxy : proxies)
+        {
+            auto& entry = m_entries[proxy.id];
+
+            // Objects which changed between static and dynamic must swap trees.
+            if (entry.proxy != AABBTree::nullNode && entry.isStatic != proxy.isStatic)
+            {
+                (entry.isStatic ? m_static : m_dynamic).destroyProxy (entry.proxy);
+                entry.proxy = AABBTree::nullNode;
+            }
+
+            auto& tree = proxy.isStatic ? m_static : m_dynamic;
+
+            if (entry.proxy == AABBTree::nullNode)
+            {
+                entry.proxy     = tree.createProxy (proxy.bounds, proxy.index);
+                entry.isStatic  = proxy.isStatic;
+            }
+
+            else
+            {
+                tree.moveProxy (entry.proxy, proxy.bounds);
+                tree.setUserData (entry.proxy, proxy.index);
+            }
+
+            entry.lastSeen = m_update;
+        }
+
+        // Remove anything which has disappeared.
+        for (auto it = m_entries.begin(); it != m_entries.end(); )
+        {
+            if (it->second.lastSeen != m_update)
+            {
+                (it->second.isStatic ? m_static : m_dynamic).destroyProxy (it->second.proxy);
+                it = m_entries.erase (it);
+            }
+
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Static objects are never paired together so the static tree is only tested against the dynamic one.
+        m_dynamic.findPairs (pairs);
+        AABBTree::findPairs (m_dynamic, m_static, pairs);
+    }
+
+
+    void TreeBroadphase::query (const AABB& bounds, std::vector<unsigned int>& indices) const
+    {
+        const auto collect = [&] (const AABBTree& tree)
+        {
+            tree.query (bounds, [&] (const int proxy) { indices.push_back (tree.getUserData (proxy)); });
+        };
+
+        collect (m_dynamic);
+        collect (m_static);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#ifndef SPC_TREE_BROADPHASE_ASP_HPP
+#define SPC_TREE_BROADPHASE_ASP_HPP
+
+
+// STL headers.
+#include <unordered_map>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/AABBTree.hpp>
+#include <Physics/Broadphase.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// A broadphase built on two dynamic AABB trees, one for static objects and one for everything else. Static
+    /// objects such as the floor never need testing against each other so they never need traversing together.
+    /// Objects are tracked across ticks by their ID and are only reinserted when they escape their fat bounds.
+    /// </summary>
+    class TreeBroadphase final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            TreeBroadphase()                                        = default;
+
+            TreeBroadphase (TreeBroadphase&& move);
+            TreeBroadphase& operator= (TreeBroadphase&& move);
+
+            TreeBroadphase (const TreeBroadphase& copy)             = default;
+            TreeBroadphase& operator= (const TreeBroadphase& copy)  = default;
+            ~TreeBroadphase()                                       = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets the margin the bounds of each object are fattened by. </summary>
+            /// <returns> The margin. </returns>
+            float getMargin() const { return m_dynamic.getMargin(); }
+
+            /// <summary>
+            /// Sets the margin the bounds of each object are fattened by. Larger margins mean fewer reinsertions but
+            /// looser bounds.
+            /// </summary>
+            /// <param name="margin"> The new margin, values below zero will be ignored. </param>
+            void setMargin (const float margin);
+
+            /// <summary>
+            /// Updates the trees with the given proxies and outputs each overlapping pair exactly once. Any proxies
+            /// which were tracked last time but are missing now are removed.
+            /// </summary>
+            /// <param name="proxies"> The finite objects to test. </param>
+            /// <param name="pairs"> The vector to append potential pairs to. </param>
+            void findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs);
+
+            /// <summary> Finds every object whose bounds overlap the given box as of the last call to findPairs. </summary>
+            /// <param name="bounds"> The area to query. </param>
+            /// <param name="indices"> The vector to append the index of each proxy found to. </param>
+            void query (const AABB& bounds, std::vector<unsigned int>& indices) const;
+
+        private:
+
+            /// <summary>
+            /// Where a tracked object lives in the trees.
+            /// </summary>
+            struct Entry final
+            {
+                int             proxy       { AABBTree::nullNode }; //!< The leaf representing the object.
+                unsigned int    lastSeen    { 0 };                  //!< The last update the object was present in.
+                bool            isStatic    { false };              //!< Which tree the leaf is in.
+            };
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            AABBTree                                    m_static    { };    //!< Contains every static object.
+            AABBTree                                    m_dynamic   { };    //!< Contains every non-static object.
+            std::unordered_map<unsigned int, Entry>     m_entries   { };    //!< Maps the ID of each object to its leaf.
+            unsigned int                                m_update    { 0 };  //!< Incremented every update to detect stale entries.
+    };
+}
+
+#endif
\ No newline at end of file
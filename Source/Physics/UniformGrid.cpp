@@ -0,0 +1,270 @@
+#include "UniformGrid.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+
+namespace spc
+{
+    //////////////////
+    // Constructors //
+    //////////////////
+
+    UniformGrid::UniformGrid (const float cellSize)
+    {
+        setCellSize (cellSize);
+    }
+
+
+    UniformGrid::UniformGrid (UniformGrid&& move)
+    {
+        *this = std::move (move);
+    }
+
+
+    UniformGrid& UniformGrid::operator= (UniformGrid&& move)
+    {
+        if (this != &move)
+        {
+            m_cellSize  = move.m_cellSize;
+            m_invSize   = move.m_invSize;
+            m_entries   = std::move (move.m_entries);
+            m_oversized = std::move (move.m_oversized);
+        }
+
+        return *this;
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void UniformGrid::setCellSize (const float cellSize)
+    {
+        if (cellSize > 0.f)
+        {
+            m_cellSize = cellSize;
+            m_invSize  = 1.f / cellSize;
+        }
+    }
+
+
+    void UniformGrid::findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs)
+    {
+        // Start afresh, the vectors keep their capacity so this won't allocate in the steady state.
+        m_entries.clear();
+        m_oversized.clear();
+
+        // Bin each proxy into every cell it touches.
+        for (auto i = 0U; i < proxies.size(); ++i)
+        {
+            const auto& bounds = proxies[i].bounds;
+
+            const auto minX = cellCoordinate (bounds.min.x), maxX = cellCoordinate (bounds.max.x),
+                       minY = cellCoordinate (bounds.min.y), maxY = cellCoordinate (bounds.max.y),
+                       minZ = cellCoordinate (bounds.min.z), maxZ = cellCoordinate (bounds.max.z);
+
+            // Huge objects would flood the grid, it's cheaper to test them against everything.
+            const auto countX = maxX - minX + 1,
+                       countY = maxY - minY + 1,
+                       countZ = maxZ - minZ + 1;
+
+            if (countX > maxCellsPerProxy || countY > maxCellsPerProxy || countZ > maxCellsPerProxy ||
+                countX * countY * countZ > maxCellsPerProxy)
+            {
+                m_oversized.push_back (i);
+                continue;
+            }
+
+            for (auto x = minX; x <= maxX; ++x)
+            {
+                for (auto y = minY; y <= maxY; ++y)
+                {
+                    for (auto z = minZ; z <= maxZ; ++z)
+                    {
+                        CellEntry entry { };
+                        entry.cell  = packCell (x, y, z);
+                        entry.proxy = i;
+                        m_entries.push_back (entry);
+                    }
+                }
+            }
+        }
+
+        // Sort the entries so that every occupant of a cell is contiguous.
+        std::sort (m_entries.begin(), m_entries.end(), [] (const CellEntry& lhs, const CellEntry& rhs)
+        {
+            return lhs.cell < rhs.cell || (lhs.cell == rhs.cell && lhs.proxy < rhs.proxy);
+        });
+
+        // Test every occupant of each cell against each other.
+        for (auto begin = 0U; begin < m_entries.size(); )
+        {
+            const auto cell = m_entries[begin].cell;
+            auto end = begin + 1;
+
+            while (end < m_entries.size() && m_entries[end].cell == cell)
+            {
+                ++end;
+            }
+
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto& lhs = proxies[m_entries[i].proxy];
+
+                for (auto j = i + 1; j < end; ++j)
+                {
+                    const auto& rhs = proxies[m_entries[j].proxy];
+
+                    // Don't check static on static collision.
+                    if ((lhs.isStatic && rhs.isStatic) || !lhs.bounds.overlaps (rhs.bounds))
+                    {
+                        continue;
+                    }
+
+                    // Two objects may share many cells, only the cell containing the lowest corner of the overlapping
+                    // region reports the pair so that it is output exactly once.
+                    const auto overlapMin = math::Vector3 (std::max (lhs.bounds.min.x, rhs.bounds.min.x),
+                                                           std::max (lhs.bounds.min.y, rhs.bounds.min.y),
+                                                           std::max (lhs.bounds.min.z, rhs.bounds.min.z));
+
+                    if (cellKey (overlapMin) == cell)
+                    {
+                        BroadphasePair pair { };
+                        pair.lhs = lhs.index;
+                        pair.rhs = rhs.index;
+                        pairs.push_back (pair);
+                    }
+                }
+            }
+
+            begin = end;
+        }
+
+        // Finally test the oversized proxies against everything, the vector is ascending so we can avoid duplicates
+        // between two oversized proxies by only pairing them one way.
+        for (const auto oversized : m_oversized)
+        {
+            const auto& lhs = proxies[oversized];
+
+            for (auto i = 0U; i < proxies.size(); ++i)
+            {
+                const auto& rhs = proxies[i];
+
+                const auto isDuplicate = i <= oversized && std::binary_search (m_oversized.cbegin(), m_oversized.cend(), i);
+
+                if (!isDuplicate && (!lhs.isStatic || !rhs.isStatic) && lhs.bounds.overlaps (rhs.bounds))
+                {
+                    BroadphasePair pair { };
+                    pair.lhs = lhs.index;
+                    pair.rhs = rhs.index;
+                    pairs.push_back (pair);
+                }
+            }
+        }
+    }
+
+
+    void UniformGrid::query (const AABB& bounds, const std::vector<BroadphaseProxy>& proxies, std::vector<unsigned int>& indices) const
+    {
+        const auto minX = cellCoordinate (bounds.min.x), maxX = cellCoordinate (bounds.max.x),
+                   minY = cellCoordinate (bounds.min.y), maxY = cellCoordinate (bounds.max.y),
+                   minZ = cellCoordinate (bounds.min.z), maxZ = cellCoordinate (bounds.max.z);
+
+        // Searching more cells than there are entries would be slower than testing every proxy.
+        const auto entries = static_cast<std::int64_t> (m_entries.size());
+        const auto countX  = maxX - minX + 1,
+                   countY  = maxY - minY + 1,
+                   countZ  = maxZ - minZ + 1;
+
+        if (countX > entries || countY > entries || countZ > entries || countX * countY > entries ||
+            countX * countY * countZ > entries)
+        {
+            for (const auto& proxy : proxies)
+            {
+                if (proxy.bounds.overlaps (bounds))
+                {
+                    indices.push_back (proxy.index);
+                }
+            }
+
+            return;
+        }
+
+        for (auto x = minX; x <= maxX; ++x)
+        {
+            for (auto y = minY; y <= maxY; ++y)
+            {
+                for (auto z = minZ; z <= maxZ; ++z)
+                {
+                    // The entries are still sorted by cell from the last call to findPairs.
+                    const auto cell = packCell (x, y, z);
+                    auto entry      = std::lower_bound (m_entries.cbegin(), m_entries.cend(), cell,
+                        [] (const CellEntry& lhs, const std::uint64_t rhs) { return lhs.cell < rhs; });
+
+                    for (; entry != m_entries.cend() && entry->cell == cell; ++entry)
+                    {
+                        const auto& proxy = proxies[entry->proxy];
+
+                        if (!proxy.bounds.overlaps (bounds))
+                        {
+                            continue;
+                        }
+
+                        // As with pairs, only the cell containing the lowest corner of the overlap reports the proxy.
+                        const auto overlapMin = math::Vector3 (std::max (proxy.bounds.min.x, bounds.min.x),
+                                                               std::max (proxy.bounds.min.y, bounds.min.y),
+                                                               std::max (proxy.bounds.min.z, bounds.min.z));
+
+                        if (cellKey (overlapMin) == cell)
+                        {
+                            indices.push_back (proxy.index);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Oversized proxies weren't binned.
+        for (const auto oversized : m_oversized)
+        {
+            if (proxies[oversized].bounds.overlaps (bounds))
+            {
+                indices.push_back (proxies[oversized].index);
+            }
+        }
+    }
+
+
+    /////////////////////
+    // Cell management //
+    /////////////////////
+
+    std::int64_t UniformGrid::cellCoordinate (const float value) const
+    {
+        return static_cast<std::int64_t> (std::floor (value * m_invSize));
+    }
+
+
+    std::uint64_t UniformGrid::packCell (const std::int64_t x, const std::int64_t y, const std::int64_t z)
+    {
+        // Each axis gets 21 bits, biased so that negative coordinates pack correctly. The grid will only alias cells
+        // which are over a million cells apart which the overlap test will reject anyway.
+        const std::uint64_t mask = (1ULL << 21) - 1,
+                            bias = 1ULL << 20;
+
+        return ((static_cast<std::uint64_t> (x) + bias) & mask) << 42 |
+               ((static_cast<std::uint64_t> (y) + bias) & mask) << 21 |
+               ((static_cast<std::uint64_t> (z) + bias) & mask);
+    }
+
+
+    std::uint64_t UniformGrid::cellKey (const math::Vector3& point) const
+    {
+        return packCell (cellCoordinate (point.x), cellCoordinate (point.y), cellCoordinate (point.z));
+    }
+}
\ No newline at end of file
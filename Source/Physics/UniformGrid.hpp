@@ -0,0 +1,109 @@
+#ifndef SPC_UNIFORM_GRID_ASP_HPP
+#define SPC_UNIFORM_GRID_ASP_HPP
+
+
+// STL headers.
+#include <cstdint>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Broadphase.hpp>
+
+
+namespace spc
+{
+    /// <summary>
+    /// A spatial hash broadphase which bins the bounds of every finite object into uniformly sized cells each tick.
+    /// Only objects which share a cell are considered potential pairs, this keeps pair generation close to linear
+    /// provided the cell size is roughly the size of the typical object in the scene.
+    /// </summary>
+    class UniformGrid final
+    {
+        public:
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            /// <summary> Construct a grid with the given cell size. </summary>
+            /// <param name="cellSize"> The width of each cell, this must be above zero. </param>
+            UniformGrid (const float cellSize = 0.5f);
+
+            UniformGrid (UniformGrid&& move);
+            UniformGrid& operator= (UniformGrid&& move);
+
+            UniformGrid (const UniformGrid& copy)               = default;
+            UniformGrid& operator= (const UniformGrid& copy)    = default;
+            ~UniformGrid()                                      = default;
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets the width of each cell in the grid. </summary>
+            /// <returns> The cell size. </returns>
+            float getCellSize() const   { return m_cellSize; }
+
+            /// <summary> Sets the width of each cell, ideally this should be close to the diameter of common objects. </summary>
+            /// <param name="cellSize"> The new cell size, values of zero or below will be ignored. </param>
+            void setCellSize (const float cellSize);
+
+            /// <summary> Bins every proxy into the grid and outputs each overlapping pair exactly once. </summary>
+            /// <param name="proxies"> The finite objects to test. </param>
+            /// <param name="pairs"> The vector to append potential pairs to. </param>
+            void findPairs (const std::vector<BroadphaseProxy>& proxies, std::vector<BroadphasePair>& pairs);
+
+            /// <summary>
+            /// Finds every proxy whose bounds overlap the given box using the cells filled by the last call to findPairs.
+            /// Each occupied cell the box covers is found with a binary search, so the cost depends on the size of the
+            /// box rather than the number of proxies. Boxes covering more cells than there are entries are scanned instead.
+            /// </summary>
+            /// <param name="bounds"> The area to query. </param>
+            /// <param name="proxies"> The proxies given to the last call to findPairs. </param>
+            /// <param name="indices"> The vector to append the index of each proxy found to. </param>
+            void query (const AABB& bounds, const std::vector<BroadphaseProxy>& proxies, std::vector<unsigned int>& indices) const;
+
+        private:
+
+            /// <summary>
+            /// Represents a proxy occupying a single cell. Sorting these by cell places every object in a cell next to
+            /// each other in memory.
+            /// </summary>
+            struct CellEntry final
+            {
+                std::uint64_t   cell    { 0 };  //!< The packed coordinates of the cell.
+                unsigned int    proxy   { 0 };  //!< The index of the proxy within the cell.
+            };
+
+
+            /// <summary> Calculates the coordinate of the cell containing the given value on a single axis. </summary>
+            /// <param name="value"> The world space value. </param>
+            /// <returns> The cell coordinate. </returns>
+            std::int64_t cellCoordinate (const float value) const;
+
+            /// <summary> Packs three cell coordinates into a single key. </summary>
+            /// <returns> A key uniquely identifying the cell. </returns>
+            static std::uint64_t packCell (const std::int64_t x, const std::int64_t y, const std::int64_t z);
+
+            /// <summary> Calculates the key of the cell containing the given point. </summary>
+            /// <param name="point"> A world space point. </param>
+            /// <returns> The key of the cell. </returns>
+            std::uint64_t cellKey (const math::Vector3& point) const;
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            static const unsigned int   maxCellsPerProxy    = 64;   //!< Proxies covering more cells than this are tested against everything instead.
+
+            float                       m_cellSize  { 0.5f };   //!< The width of each cell.
+            float                       m_invSize   { 2.f };    //!< The reciprocal of the cell size, avoids division when binning.
+            std::vector<CellEntry>      m_entries   { };        //!< Every cell occupied by every proxy, reused between ticks.
+            std::vector<unsigned int>   m_oversized { };        //!< Proxies which are too big to be worth binning.
+    };
+}
+
+#endif
\ No newline at end of file
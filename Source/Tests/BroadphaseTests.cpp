@@ -0,0 +1,208 @@
+// STL headers.
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+// Personal headers.
+#include <Physics/Broadphase.hpp>
+#include <Physics/SweepAndPrune.hpp>
+#include <Physics/TreeBroadphase.hpp>
+#include <Physics/UniformGrid.hpp>
+#include <Tests/Check.hpp>
+
+
+namespace
+{
+    using PairSet = std::vector<std::pair<unsigned int, unsigned int>>;
+
+
+    /// <summary> Sorts pairs into a canonical form, broadphases may output them in any order. </summary>
+    /// <param name="pairs"> The pairs found by a broadphase. </param>
+    /// <returns> Each pair with the lowest index first, sorted. </returns>
+    PairSet canonical (const std::vector<spc::BroadphasePair>& pairs)
+    {
+        PairSet result { };
+
+        for (const auto& pair : pairs)
+        {
+            result.emplace_back (std::min (pair.lhs, pair.rhs), std::max (pair.lhs, pair.rhs));
+        }
+
+        std::sort (result.begin(), result.end());
+        return result;
+    }
+
+
+    /// <summary> Pairs proxies the way the original nested loop did, which every broadphase must match. </summary>
+    /// <param name="proxies"> The proxies to test. </param>
+    /// <returns> Every overlapping pair where at least one proxy isn't static. </returns>
+    PairSet nestedLoop (const std::vector<spc::BroadphaseProxy>& proxies)
+    {
+        std::vector<spc::BroadphasePair> pairs { };
+
+        for (auto i = 0U; i < proxies.size(); ++i)
+        {
+            for (auto j = i + 1; j < proxies.size(); ++j)
+            {
+                const auto& lhs = proxies[i];
+                const auto& rhs = proxies[j];
+
+                if ((!lhs.isStatic || !rhs.isStatic) && lhs.bounds.overlaps (rhs.bounds))
+                {
+                    spc::BroadphasePair pair { };
+                    pair.lhs = lhs.index;
+                    pair.rhs = rhs.index;
+                    pairs.push_back (pair);
+                }
+            }
+        }
+
+        return canonical (pairs);
+    }
+
+
+    /// <summary> Finds what a query should return by testing every proxy. </summary>
+    /// <param name="bounds"> The area searched. </param>
+    /// <param name="proxies"> The proxies to test. </param>
+    /// <returns> The sorted index of every overlapping proxy. </returns>
+    std::vector<unsigned int> scan (const spc::AABB& bounds, const std::vector<spc::BroadphaseProxy>& proxies)
+    {
+        std::vector<unsigned int> result { };
+
+        for (const auto& proxy : proxies)
+        {
+            if (proxy.bounds.overlaps (bounds))
+            {
+                result.push_back (proxy.index);
+            }
+        }
+
+        std::sort (result.begin(), result.end());
+        return result;
+    }
+
+
+    /// <summary>
+    /// Simulates a scene over many ticks: proxies drift a little each tick like resting bodies, some jump far away,
+    /// some are destroyed and new ones are created. The persistent broadphases see the same proxies every tick.
+    /// </summary>
+    /// <param name="seed"> Seeds the scene. </param>
+    /// <param name="count"> How many proxies the scene starts with. </param>
+    /// <param name="extent"> How far from the origin proxies are placed. </param>
+    void testScene (const unsigned int seed, const unsigned int count, const float extent)
+    {
+        std::minstd_rand random (seed);
+        std::uniform_real_distribution<float>   place   (-extent, extent);
+        std::uniform_real_distribution<float>   size    (0.05f, 0.6f);
+        std::uniform_real_distribution<float>   drift   (-0.02f, 0.02f);
+        std::uniform_real_distribution<float>   chance  (0.f, 1.f);
+
+        const auto makeProxy = [&] (const unsigned int id)
+        {
+            // A few proxies are far larger than a grid cell.
+            const auto half = chance (random) < 0.05f ? size (random) * 10.f : size (random);
+
+            spc::BroadphaseProxy proxy { };
+            proxy.bounds    = spc::AABB::fromCentre ({ place (random), place (random), place (random) }, { half, half, half });
+            proxy.id        = id;
+            proxy.isStatic  = chance (random) < 0.3f;
+            return proxy;
+        };
+
+        std::vector<spc::BroadphaseProxy> proxies { };
+        auto nextID = 1U;
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            proxies.push_back (makeProxy (nextID++));
+        }
+
+        spc::UniformGrid    grid            { };
+        spc::SweepAndPrune  sweepAndPrune   { };
+        spc::TreeBroadphase tree            { };
+
+        for (auto tick = 0U; tick < 30; ++tick)
+        {
+            for (auto& proxy : proxies)
+            {
+                const auto move = chance (random) < 0.02f
+                                ? math::Vector3 (place (random), place (random), place (random)) - proxy.bounds.min
+                                : math::Vector3 (drift (random), drift (random), drift (random));
+
+                proxy.bounds.min = proxy.bounds.min + move;
+                proxy.bounds.max = proxy.bounds.max + move;
+            }
+
+            // Destroyed objects disappear from the middle of the list and new ones are appended, like the registry.
+            for (auto i = 0U; i < proxies.size(); ++i)
+            {
+                if (chance (random) < 0.01f)
+                {
+                    proxies[i] = proxies.back();
+                    proxies.pop_back();
+                }
+            }
+
+            while (proxies.size() < count)
+            {
+                proxies.push_back (makeProxy (nextID++));
+            }
+
+            // Indices are positions in the list each tick, offset so they can't be confused with the position.
+            for (auto i = 0U; i < proxies.size(); ++i)
+            {
+                proxies[i].index = i * 2 + 1;
+            }
+
+            const auto expected = nestedLoop (proxies);
+
+            std::vector<spc::BroadphasePair> pairs { };
+            grid.findPairs (proxies, pairs);
+            SPC_CHECK (canonical (pairs) == expected);
+
+            pairs.clear();
+            sweepAndPrune.findPairs (proxies, pairs);
+            SPC_CHECK (canonical (pairs) == expected);
+
+            pairs.clear();
+            tree.findPairs (proxies, pairs);
+            SPC_CHECK (canonical (pairs) == expected);
+
+            // Queries of every size must find exactly what a scan would.
+            for (auto query = 0U; query < 8; ++query)
+            {
+                const auto half     = size (random) * static_cast<float> (query + 1);
+                const auto bounds   = spc::AABB::fromCentre ({ place (random), place (random), place (random) }, { half, half, half });
+                const auto found    = scan (bounds, proxies);
+
+                std::vector<unsigned int> indices { };
+                grid.query (bounds, proxies, indices);
+                std::sort (indices.begin(), indices.end());
+                SPC_CHECK (indices == found);
+
+                indices.clear();
+                tree.query (bounds, indices);
+                std::sort (indices.begin(), indices.end());
+                SPC_CHECK (indices == found);
+            }
+        }
+    }
+}
+
+
+/// <summary>
+/// Checks that the uniform grid, sweep-and-prune and AABB tree broadphases find exactly the same pairs as testing
+/// every proxy against every other one, across randomised scenes of varying density.
+/// </summary>
+int main()
+{
+    testScene (1, 0, 5.f);
+    testScene (2, 1, 5.f);
+    testScene (3, 50, 2.f);
+    testScene (4, 300, 5.f);
+    testScene (5, 1000, 20.f);
+
+    return test::finish ("BroadphaseTests");
+}
\ No newline at end of file
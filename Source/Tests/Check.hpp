@@ -0,0 +1,49 @@
+#ifndef SPC_CHECK_ASP_HPP
+#define SPC_CHECK_ASP_HPP
+
+
+// STL headers.
+#include <cstdio>
+
+
+namespace test
+{
+    /// <summary> Gets how many checks have failed so far, each test returns non-zero if any did. </summary>
+    /// <returns> The number of failures. </returns>
+    inline int& failures()
+    {
+        static auto count = 0;
+        return count;
+    }
+
+
+    /// <summary> Reports a failed check without stopping, so one run shows every failure. </summary>
+    /// <param name="passed"> Whether the check passed. </param>
+    /// <param name="expression"> The source of the check. </param>
+    /// <param name="file"> The file containing the check. </param>
+    /// <param name="line"> The line of the check. </param>
+    inline void check (const bool passed, const char* const expression, const char* const file, const int line)
+    {
+        if (!passed)
+        {
+            std::printf ("%s:%d: check failed: %s\n", file, line, expression);
+            ++failures();
+        }
+    }
+
+
+    /// <summary> Prints a summary and converts the failure count into the exit code of a test. </summary>
+    /// <param name="name"> The name of the test. </param>
+    /// <returns> 0 if every check passed, 1 otherwise. </returns>
+    inline int finish (const char* const name)
+    {
+        std::printf ("%s: %d failure(s)\n", name, failures());
+        return failures() == 0 ? 0 : 1;
+    }
+}
+
+
+/// <summary> Checks a condition, recording the failure and carrying on if it's false. </summary>
+#define SPC_CHECK(condition) test::check ((condition), #condition, __FILE__, __LINE__)
+
+#endif
\ No newline at end of file
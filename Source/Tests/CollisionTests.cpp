@@ -0,0 +1,343 @@
+// STL headers.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/CollisionDetection.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/PhysicsBox.hpp>
+#include <Physics/PhysicsPlane.hpp>
+#include <Physics/PhysicsSystem.hpp>
+#include <Tests/Check.hpp>
+
+
+namespace
+{
+    const auto root = 0.70710678f;  //!< The sine and cosine of 45 degrees.
+
+
+    /// <summary> Checks two values are within a tolerance of each other. </summary>
+    bool near (const float lhs, const float rhs, const float tolerance = 1e-4f)
+    {
+        return std::abs (lhs - rhs) <= tolerance;
+    }
+
+
+    /// <summary> Checks two vectors are within a tolerance of each other on every axis. </summary>
+    bool near (const math::Vector3& lhs, const math::Vector3& rhs, const float tolerance = 1e-4f)
+    {
+        return near (lhs.x, rhs.x, tolerance) && near (lhs.y, rhs.y, tolerance) && near (lhs.z, rhs.z, tolerance);
+    }
+
+
+    /// <summary> Creates the collider of an attached sphere. </summary>
+    spc::Collider sphere (const math::Vector3& centre, const float radius)
+    {
+        spc::Collider collider { };
+        collider.type       = spc::PhysicsObject::Type::Sphere;
+        collider.attached   = true;
+        collider.centre     = centre;
+        collider.radius     = radius;
+        return collider;
+    }
+
+
+    /// <summary> Creates the collider of an attached box, the axes must be unit length and perpendicular. </summary>
+    spc::Collider box (const math::Vector3& centre, const std::array<math::Vector3, 3>& axes, const std::array<float, 3>& halfExtents)
+    {
+        spc::Collider collider { };
+        collider.type           = spc::PhysicsObject::Type::Box;
+        collider.attached       = true;
+        collider.centre         = centre;
+        collider.axes           = axes;
+        collider.halfExtents    = halfExtents;
+        return collider;
+    }
+
+
+    /// <summary> Creates the collider of an attached unit cube aligned with the world axes. </summary>
+    spc::Collider cube (const math::Vector3& centre)
+    {
+        return box (centre, { { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } } }, { { 0.5f, 0.5f, 0.5f } });
+    }
+
+
+    /// <summary> Creates the collider of an attached plane through the origin. </summary>
+    spc::Collider plane (const math::Vector3& normal)
+    {
+        spc::Collider collider { };
+        collider.type       = spc::PhysicsObject::Type::Plane;
+        collider.attached   = true;
+        collider.normal     = normal;
+        collider.offset     = 0.f;
+        return collider;
+    }
+
+
+    /// <summary> Checks every contact of a manifold is at the given height and depth. </summary>
+    void checkContacts (const spc::ContactManifold& manifold, const float height, const float depth)
+    {
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            SPC_CHECK (near (manifold.contacts[i].point.y, height, 1e-3f));
+            SPC_CHECK (near (manifold.contacts[i].depth, depth, 1e-3f));
+        }
+    }
+
+
+    /// <summary> Checks a cube resting on another touches across the whole face and separates once lifted clear. </summary>
+    void testBoxOnBoxFace()
+    {
+        spc::ContactManifold manifold { };
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (cube ({ 0.f, 0.f, 0.f }), cube ({ 0.f, 0.95f, 0.f }), manifold));
+        SPC_CHECK (near (manifold.normal, { 0.f, 1.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 4);
+        checkContacts (manifold, 0.475f, 0.05f);
+
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            SPC_CHECK (near (std::abs (manifold.contacts[i].point.x), 0.5f) && near (std::abs (manifold.contacts[i].point.z), 0.5f));
+        }
+
+        SPC_CHECK (!spc::CollisionDetection::detectCollision (cube ({ 0.f, 0.f, 0.f }), cube ({ 0.2f, 1.05f, 0.f }), manifold));
+        SPC_CHECK (near (std::abs (manifold.normal.y), 1.f));
+    }
+
+
+    /// <summary> Checks a cube rolled 45 degrees onto an edge touches the face below along that edge. </summary>
+    void testEdgeOnFace()
+    {
+        const auto rolled = box ({ 0.f, 0.5f + root - 0.05f, 0.f }, { { { root, root, 0.f }, { -root, root, 0.f }, { 0.f, 0.f, 1.f } } },
+                                 { { 0.5f, 0.5f, 0.5f } });
+
+        spc::ContactManifold manifold { };
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (cube ({ 0.f, 0.f, 0.f }), rolled, manifold));
+        SPC_CHECK (near (manifold.normal, { 0.f, 1.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 2);
+        checkContacts (manifold, 0.475f, 0.05f);
+
+        // The contacts are the ends of the edge, clipped to the face below.
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            SPC_CHECK (near (manifold.contacts[i].point.x, 0.f, 1e-3f) && near (std::abs (manifold.contacts[i].point.z), 0.5f));
+        }
+    }
+
+
+    /// <summary> Checks two cubes rolled onto crossing edges touch at a single point between the edges. </summary>
+    void testEdgeOnEdge()
+    {
+        const auto lower = box ({ 0.f, 0.f, 0.f }, { { { root, root, 0.f }, { -root, root, 0.f }, { 0.f, 0.f, 1.f } } },
+                                { { 0.5f, 0.5f, 0.5f } });
+        const auto upper = box ({ 0.f, 2.f * root - 0.05f, 0.f }, { { { 1.f, 0.f, 0.f }, { 0.f, root, root }, { 0.f, -root, root } } },
+                                { { 0.5f, 0.5f, 0.5f } });
+
+        spc::ContactManifold manifold { };
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (lower, upper, manifold));
+        SPC_CHECK (near (manifold.normal, { 0.f, 1.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 1);
+        SPC_CHECK (near (manifold.contacts[0].point, { 0.f, root - 0.025f, 0.f }, 1e-3f));
+        SPC_CHECK (near (manifold.contacts[0].depth, 0.05f, 1e-3f));
+    }
+
+
+    /// <summary> Checks boxes on a plane: flat, tilted onto an edge, lifted clear and sunk past their middle. </summary>
+    void testBoxOnPlane()
+    {
+        const auto ground = plane ({ 0.f, 1.f, 0.f });
+
+        spc::ContactManifold manifold { };
+
+        // Flat boxes touch at every corner of the bottom face.
+        SPC_CHECK (spc::CollisionDetection::detectCollision (cube ({ 0.f, 0.45f, 0.f }), ground, manifold));
+        SPC_CHECK (near (manifold.normal, { 0.f, -1.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 4);
+        checkContacts (manifold, -0.025f, 0.05f);
+
+        SPC_CHECK (!spc::CollisionDetection::detectCollision (cube ({ 0.f, 0.55f, 0.f }), ground, manifold));
+
+        // Tilting the box by 30 degrees leaves only the corners of one edge below the plane.
+        const auto cosine = std::cos (0.5235988f), sine = std::sin (0.5235988f);
+        const auto lowest = 0.5f * (cosine + sine);
+        const auto tilted = box ({ 0.f, lowest - 0.05f, 0.f }, { { { cosine, sine, 0.f }, { -sine, cosine, 0.f }, { 0.f, 0.f, 1.f } } },
+                                { { 0.5f, 0.5f, 0.5f } });
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (tilted, ground, manifold));
+        SPC_CHECK (manifold.contactCount == 2);
+        checkContacts (manifold, -0.025f, 0.05f);
+
+        // A sunk box has more corners below the plane than a manifold holds, only the deepest four are kept.
+        const auto a     = math::unit ({ 0.8f, 0.3f, -0.2f });
+        const auto b     = math::unit (math::cross (a, { 0.f, 1.f, 0.f }));
+        const auto c     = math::cross (a, b);
+        const auto sunk  = box ({ 0.f, -0.3f, 0.f }, { { a, b, c } }, { { 0.5f, 0.4f, 0.3f } });
+
+        std::vector<float> depths { };
+
+        for (auto corner = 0U; corner < 8; ++corner)
+        {
+            auto point = sunk.centre;
+
+            for (auto i = 0U; i < 3; ++i)
+            {
+                point += sunk.axes[i] * ((corner & (1U << i)) ? sunk.halfExtents[i] : -sunk.halfExtents[i]);
+            }
+
+            if (point.y < 0.f)
+            {
+                depths.push_back (-point.y);
+            }
+        }
+
+        std::sort (depths.begin(), depths.end());
+        SPC_CHECK (depths.size() > spc::ContactManifold::maxContacts);
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (sunk, ground, manifold));
+        SPC_CHECK (manifold.contactCount == spc::ContactManifold::maxContacts);
+
+        for (auto i = 0U; i < manifold.contactCount; ++i)
+        {
+            SPC_CHECK (manifold.contacts[i].depth >= depths[depths.size() - spc::ContactManifold::maxContacts] - 1e-5f);
+        }
+    }
+
+
+    /// <summary>
+    /// Checks spheres touching a box face from outside, including centres placed on the faces of rotated boxes where
+    /// rounding can leave no direction to the closest point.
+    /// </summary>
+    void testSphereOnBoxFace()
+    {
+        spc::ContactManifold manifold { };
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (sphere ({ 0.1f, 0.7f, -0.2f }, 0.25f), cube ({ 0.f, 0.f, 0.f }), manifold));
+        SPC_CHECK (near (manifold.normal, { 0.f, -1.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 1);
+        SPC_CHECK (near (manifold.contacts[0].point, { 0.1f, 0.475f, -0.2f }));
+        SPC_CHECK (near (manifold.contacts[0].depth, 0.05f));
+
+        SPC_CHECK (!spc::CollisionDetection::detectCollision (sphere ({ 0.f, 0.8f, 0.f }, 0.25f), cube ({ 0.f, 0.f, 0.f }), manifold));
+
+        std::minstd_rand random (3);
+        std::uniform_real_distribution<float> value (-1.f, 1.f);
+
+        auto valid = true;
+
+        for (auto test = 0U; test < 10000; ++test)
+        {
+            const auto a = math::unit ({ value (random), value (random), value (random) });
+            const auto b = math::unit (math::cross (a, { value (random), value (random), value (random) }));
+            const auto c = math::cross (a, b);
+
+            const auto centre   = math::Vector3 (value (random), value (random), value (random)) * 10.f;
+            const auto rotated  = box (centre, { { a, b, c } }, { { 0.5f, 0.7f, 0.3f } });
+            const auto surface  = centre + a * 0.5f + b * (value (random) * 0.7f) + c * (value (random) * 0.3f);
+
+            const auto touching = spc::CollisionDetection::detectCollision (sphere (surface, 0.25f), rotated, manifold);
+            const auto length   = math::length (manifold.normal);
+
+            valid &= touching && manifold.contactCount == 1 && near (length, 1.f, 1e-3f) && near (manifold.contacts[0].depth, 0.25f, 1e-3f);
+        }
+
+        SPC_CHECK (valid);
+    }
+
+
+    /// <summary> Checks spheres whose centre is inside a box are pushed out through the nearest face. </summary>
+    void testSphereInsideBox()
+    {
+        spc::ContactManifold manifold { };
+
+        SPC_CHECK (spc::CollisionDetection::detectCollision (sphere ({ 0.3f, 0.1f, 0.f }, 0.25f), cube ({ 0.f, 0.f, 0.f }), manifold));
+        SPC_CHECK (near (manifold.normal, { -1.f, 0.f, 0.f }));
+        SPC_CHECK (manifold.contactCount == 1);
+        SPC_CHECK (near (manifold.contacts[0].depth, 0.45f));
+
+        // A sphere at the very centre still gets a face to leave through.
+        SPC_CHECK (spc::CollisionDetection::detectCollision (sphere ({ 0.f, 0.f, 0.f }, 0.25f), cube ({ 0.f, 0.f, 0.f }), manifold));
+        SPC_CHECK (near (math::length (manifold.normal), 1.f));
+        SPC_CHECK (near (manifold.contacts[0].depth, 0.75f));
+    }
+
+
+    /// <summary> Simulates a stack of cubes on a plane, which must settle without sliding, sinking or toppling. </summary>
+    void testRestingStack()
+    {
+        spc::EngineClock::setTickInterval (1.f / 60.f);
+
+        auto system = std::make_shared<spc::PhysicsSystem>();
+        system->setFixedTimestep (true);
+        system->setDeterministic (true);
+
+        std::vector<std::shared_ptr<spc::EngineActor>> actors { };
+
+        const auto attach = [&] (const std::shared_ptr<spc::PhysicsObject>& object, const float height)
+        {
+            auto transform  = math::Matrix4x4();
+            transform._31   = height;
+
+            auto actor = std::make_shared<spc::EngineActor>();
+            actor->setTransformation (transform);
+            actor->attachComponent (object);
+            actors.push_back (actor);
+        };
+
+        auto ground = system->createObject<spc::PhysicsPlane>();
+        ground->setStatic (true);
+        attach (ground, 0.f);
+
+        std::vector<std::shared_ptr<spc::PhysicsBox>> boxes { };
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            boxes.push_back (system->createObject<spc::PhysicsBox>());
+            attach (boxes.back(), 0.5f + i * 1.f);
+        }
+
+        auto& task = static_cast<spc::EngineTask&> (*system);
+
+        for (auto tick = 0U; tick < 300; ++tick)
+        {
+            task.runloopWillBegin();
+            task.runloopExecuteTask();
+            task.runloopDidEnd();
+        }
+
+        for (auto i = 0U; i < boxes.size(); ++i)
+        {
+            const auto position = boxes[i]->position();
+
+            SPC_CHECK (near (position.y, 0.5f + i * 1.f, 0.05f));
+            SPC_CHECK (near (position.x, 0.f, 0.01f) && near (position.z, 0.f, 0.01f));
+            SPC_CHECK (math::length (boxes[i]->getVelocity()) < 0.1f);
+            SPC_CHECK (near (boxes[i]->U().y, 0.f, 0.01f) && near (boxes[i]->V().y, 1.f, 0.01f));
+        }
+    }
+}
+
+
+/// <summary>
+/// Checks the narrowphase tests of boxes against boxes, planes and spheres produce the expected normals, depths and
+/// contacts, and that a stack of boxes rests on a plane.
+/// </summary>
+int main()
+{
+    testBoxOnBoxFace();
+    testEdgeOnFace();
+    testEdgeOnEdge();
+    testBoxOnPlane();
+    testSphereOnBoxFace();
+    testSphereInsideBox();
+    testRestingStack();
+
+    return test::finish ("CollisionTests");
+}
\ No newline at end of file
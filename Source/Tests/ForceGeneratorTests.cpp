@@ -0,0 +1,130 @@
+// STL headers.
+#include <memory>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/ForceFields.hpp>
+#include <Physics/PhysicsPlane.hpp>
+#include <Physics/PhysicsSphere.hpp>
+#include <Physics/PhysicsSystem.hpp>
+#include <Tests/Check.hpp>
+
+
+namespace
+{
+    /// <summary> A system with every object it contains, which must be attached to an actor to be simulated. </summary>
+    struct Scene final
+    {
+        std::shared_ptr<spc::PhysicsSystem>             system  { std::make_shared<spc::PhysicsSystem>() }; //!< The system being tested.
+        std::vector<std::shared_ptr<spc::EngineActor>>  actors  { };                                        //!< Keeps the actors alive.
+
+        Scene()
+        {
+            spc::EngineClock::setTickInterval (1.f / 60.f);
+            system->setFixedTimestep (true);
+            system->setDeterministic (true);
+        }
+
+        /// <summary> Attaches an object to a new actor at the given position. </summary>
+        /// <param name="object"> The object to attach. </param>
+        /// <param name="position"> The starting position of the object. </param>
+        void attach (const std::shared_ptr<spc::PhysicsObject>& object, const math::Vector3& position)
+        {
+            auto transform  = math::Matrix4x4();
+            transform._30   = position.x;
+            transform._31   = position.y;
+            transform._32   = position.z;
+
+            auto actor = std::make_shared<spc::EngineActor>();
+            actor->setTransformation (transform);
+            actor->attachComponent (object);
+            actors.push_back (actor);
+        }
+
+        /// <summary> Runs ticks the way the engine runloop would. </summary>
+        /// <param name="count"> How many ticks to run. </param>
+        void tick (const unsigned int count)
+        {
+            auto& task = static_cast<spc::EngineTask&> (*system);
+
+            for (auto i = 0U; i < count; ++i)
+            {
+                task.runloopWillBegin();
+                task.runloopExecuteTask();
+                task.runloopDidEnd();
+            }
+        }
+    };
+
+
+    /// <summary>
+    /// Lets spheres fall asleep on a plane, far enough apart to sleep alone, then adds fields over them. Only the
+    /// spheres a field would push may wake, as drag gives nothing to a body at rest.
+    /// </summary>
+    void testAddingWakes()
+    {
+        Scene scene { };
+
+        auto ground = scene.system->createObject<spc::PhysicsPlane>();
+        ground->setStatic (true);
+        scene.attach (ground, { 0.f, 0.f, 0.f });
+
+        std::vector<std::shared_ptr<spc::PhysicsSphere>> spheres { };
+
+        for (auto i = 0U; i < 3; ++i)
+        {
+            spheres.push_back (scene.system->createObject<spc::PhysicsSphere>());
+            spheres.back()->radius = 0.25f;
+            scene.attach (spheres.back(), { i * 5.f, 0.25f, 0.f });
+        }
+
+        scene.tick (120);
+
+        for (const auto& sphere : spheres)
+        {
+            SPC_CHECK (sphere->isSleeping());
+        }
+
+        scene.system->addForceGenerator (std::make_shared<spc::LinearDrag>());
+
+        for (const auto& sphere : spheres)
+        {
+            SPC_CHECK (sphere->isSleeping());
+        }
+
+        // Wind only blows around the first sphere and the spring only holds the second.
+        auto wind       = std::make_shared<spc::WindVolume>();
+        wind->volume    = spc::AABB::fromCentre ({ 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+        scene.system->addForceGenerator (wind);
+
+        auto spring     = std::make_shared<spc::Spring>();
+        spring->first   = spheres[1];
+        spring->anchor  = math::Vector3 (5.f, 3.f, 0.f);
+        scene.system->addForceGenerator (spring);
+
+        const auto start = spheres[0]->position();
+
+        scene.tick (1);
+
+        SPC_CHECK (!spheres[0]->isSleeping());
+        SPC_CHECK (!spheres[1]->isSleeping());
+        SPC_CHECK (spheres[2]->isSleeping());
+
+        scene.tick (30);
+
+        SPC_CHECK (spheres[0]->position().x > start.x + 0.01f);
+        SPC_CHECK (spheres[1]->position().y > 0.3f);
+    }
+}
+
+
+/// <summary> Checks that adding force generators wakes the sleeping bodies they push and leaves the rest asleep. </summary>
+int main()
+{
+    testAddingWakes();
+
+    return test::finish ("ForceGeneratorTests");
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+// STL headers.
+#include <random>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/BatchEulerIntegrator.hpp>
+#include <Maths/BatchRK4Integrator.hpp>
+#include <Maths/EngineMath.hpp>
+#include <Maths/EulerIntegrator.hpp>
+#include <Maths/RK4Integrator.hpp>
+#include <Tests/Check.hpp>
+
+
+namespace
+{
+    /// <summary> The force model of the PhysicsSystem, written as a plain functor rather than a lambda. </summary>
+    struct DragModel final
+    {
+        math::Vector3   accel   { };        //!< Force * inverse mass + gravity.
+        float           drag    { 0.f };    //!< The drag co-efficient.
+
+        math::Vector3 operator() (const math::Vector3&, const math::Vector3& velocity, const float) const
+        {
+            return accel + velocity * -drag;
+        }
+    };
+
+
+    /// <summary> Checks two vectors are exactly equal on every axis, without any tolerance. </summary>
+    /// <param name="lhs"> The first vector. </param>
+    /// <param name="rhs"> The second vector. </param>
+    /// <returns> Whether every axis is equal. </returns>
+    bool identical (const math::Vector3& lhs, const math::Vector3& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+    }
+
+
+    /// <summary>
+    /// Steps the same bodies through the inlined template overload, the std::function overload and a functor, which
+    /// must all give identical results as the std::function overload only forwards to the template.
+    /// </summary>
+    template <template <typename, typename> class Integrator> void testOverloads (const unsigned int seed)
+    {
+        using Scalar = Integrator<math::Vector3, float>;
+
+        std::minstd_rand random (seed);
+        std::uniform_real_distribution<float> value (-10.f, 10.f);
+        std::uniform_real_distribution<float> drag  (0.f, 2.f);
+
+        for (auto body = 0U; body < 100; ++body)
+        {
+            DragModel model { };
+            model.accel = math::Vector3 (value (random), value (random), value (random));
+            model.drag  = drag (random);
+
+            const auto lambda = [=] (const math::Vector3& position, const math::Vector3& velocity, const float time)
+            {
+                return model (position, velocity, time);
+            };
+
+            const typename Scalar::AccelFunc function = lambda;
+
+            const auto startPosition = math::Vector3 (value (random), value (random), value (random));
+            const auto startVelocity = math::Vector3 (value (random), value (random), value (random));
+
+            auto p1 = startPosition, v1 = startVelocity;
+            auto p2 = startPosition, v2 = startVelocity;
+            auto p3 = startPosition, v3 = startVelocity;
+
+            for (auto step = 0U; step < 120; ++step)
+            {
+                const auto time = step / 60.f;
+
+                Scalar::integrate (p1, v1, lambda, time, 1.f / 60.f);
+                Scalar::integrate (p2, v2, function, time, 1.f / 60.f);
+                Scalar::integrate (p3, v3, model, time, 1.f / 60.f);
+            }
+
+            SPC_CHECK (identical (p1, p2) && identical (v1, v2));
+            SPC_CHECK (identical (p1, p3) && identical (v1, v3));
+        }
+    }
+
+
+    /// <summary>
+    /// Steps random bodies with a batch integrator and with the template overload of the matching scalar integrator,
+    /// which the batch integrators promise to match exactly. Counts which aren't a multiple of the register width
+    /// exercise the scalar tail of the batch.
+    /// </summary>
+    template <typename Batch, template <typename, typename> class Integrator> void testBatch (const unsigned int seed, const unsigned int count)
+    {
+        std::minstd_rand random (seed);
+        std::uniform_real_distribution<float> value (-10.f, 10.f);
+        std::uniform_real_distribution<float> mass  (0.1f, 5.f);
+        std::uniform_real_distribution<float> drag  (0.f, 2.f);
+
+        std::vector<float> position (count), velocity (count), force (count), inverseMass (count), drags (count), motion (count);
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            position[i]     = value (random);
+            velocity[i]     = value (random);
+            force[i]        = value (random);
+            inverseMass[i]  = 1.f / mass (random);
+            drags[i]        = drag (random);
+            motion[i]       = i % 7 == 3 ? 0.f : 1.f;
+        }
+
+        auto expectedPosition = position;
+        auto expectedVelocity = velocity;
+
+        const auto gravity      = -9.81f;
+        const auto deltaTime    = 1.f / 120.f;
+
+        typename Batch::Bodies bodies { };
+        bodies.inverseMass  = inverseMass.data();
+        bodies.drag         = drags.data();
+        bodies.motion       = motion.data();
+        bodies.count        = count;
+
+        Batch::integrate ({ position.data(), velocity.data(), force.data(), gravity }, bodies, deltaTime);
+
+        for (auto i = 0U; i < count; ++i)
+        {
+            if (motion[i] == 0.f)
+            {
+                continue;
+            }
+
+            const auto accel    = force[i] * inverseMass[i] + gravity;
+            const auto negDrag  = -drags[i];
+
+            Integrator<float, float>::integrate (expectedPosition[i], expectedVelocity[i],
+                [=] (const float&, const float& v, const float) { return accel + v * negDrag; }, 0.f, deltaTime);
+        }
+
+        SPC_CHECK (position == expectedPosition);
+        SPC_CHECK (velocity == expectedVelocity);
+    }
+}
+
+
+/// <summary>
+/// Checks that the template and std::function overloads of the scalar integrators agree, and that the batch
+/// integrators used by the PhysicsSystem and particles give the same results as the scalar ones.
+/// </summary>
+int main()
+{
+    testOverloads<EulerIntegrator> (1);
+    testOverloads<RK4Integrator> (2);
+
+    for (const auto count : { 0U, 1U, 7U, 8U, 33U, 1000U })
+    {
+        testBatch<BatchEulerIntegrator, EulerIntegrator> (count + 3, count);
+        testBatch<BatchRK4Integrator, RK4Integrator> (count + 4, count);
+    }
+
+    return test::finish ("IntegratorTests");
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// STL headers.
+#include <cmath>
+#include <memory>
+#include <vector>
+
+
+// Personal headers.
+#include <Maths/EngineMath.hpp>
+#include <Physics/Engine.hpp>
+#include <Physics/PhysicsSphere.hpp>
+#include <Physics/PhysicsSystem.hpp>
+#include <Tests/Check.hpp>
+
+
+namespace
+{
+    /// <summary> A system with every object it contains, which must be attached to an actor to be simulated. </summary>
+    struct Scene final
+    {
+        std::shared_ptr<spc::PhysicsSystem>             system  { std::make_shared<spc::PhysicsSystem>() }; //!< The system being tested.
+        std::vector<std::shared_ptr<spc::EngineActor>>  actors  { };                                        //!< Keeps the actors alive.
+
+        Scene()
+        {
+            // Without gravity the only velocity an object gains comes from the impulses.
+            spc::EngineClock::setTickInterval (1.f / 60.f);
+            system->setFixedTimestep (true);
+            system->setDeterministic (true);
+            system->setGravity ({ 0.f, 0.f, 0.f });
+        }
+
+        /// <summary> Creates a sphere with a mass of one attached to an actor at the given position. </summary>
+        /// <param name="position"> The starting position of the sphere. </param>
+        /// <returns> The attached sphere. </returns>
+        std::shared_ptr<spc::PhysicsSphere> addSphere (const math::Vector3& position)
+        {
+            auto transform  = math::Matrix4x4();
+            transform._30   = position.x;
+            transform._31   = position.y;
+            transform._32   = position.z;
+
+            auto actor  = std::make_shared<spc::EngineActor>();
+            auto sphere = system->createObject<spc::PhysicsSphere>();
+            sphere->radius = 0.25f;
+            sphere->setMass (1.f);
+            actor->setTransformation (transform);
+            actor->attachComponent (sphere);
+            actors.push_back (actor);
+
+            return sphere;
+        }
+
+        /// <summary> Runs a single tick the way the engine runloop would. </summary>
+        void tick()
+        {
+            auto& task = static_cast<spc::EngineTask&> (*system);
+            task.runloopWillBegin();
+            task.runloopExecuteTask();
+            task.runloopDidEnd();
+        }
+    };
+
+
+    /// <summary> Checks whether a vector is zero on every axis. </summary>
+    /// <param name="vector"> The vector to check. </param>
+    /// <returns> Whether every axis is zero. </returns>
+    bool isZero (const math::Vector3& vector)
+    {
+        return vector.x == 0.f && vector.y == 0.f && vector.z == 0.f;
+    }
+
+
+    /// <summary>
+    /// Triggers two neighbouring mines in the same tick, the way ToyMine does. Each must be pushed directly away from
+    /// the other by the other's blast but not by its own, whilst static objects and objects out of reach stay still.
+    /// </summary>
+    void testSimultaneousBlasts()
+    {
+        Scene scene { };
+
+        // Objects don't know their position until the first tick pulls it from their actor, so the centres are given.
+        const auto firstCentre  = math::Vector3 (0.f, 0.5f, 0.f);
+        const auto secondCentre = math::Vector3 (1.f, 0.5f, 0.f);
+
+        auto first  = scene.addSphere (firstCentre);
+        auto second = scene.addSphere (secondCentre);
+        auto wall   = scene.addSphere ({ 0.f, 0.5f, 1.f });
+        auto far    = scene.addSphere ({ 10.f, 0.5f, 0.f });
+        wall->setStatic (true);
+
+        const auto Constant = spc::PhysicsSystem::Falloff::Constant;
+        scene.system->applyRadialImpulse (firstCentre, 3.f, 6.f, Constant, first.get());
+        scene.system->applyRadialImpulse (secondCentre, 3.f, 6.f, Constant, second.get());
+        SPC_CHECK (scene.system->getQueuedImpulseCount() == 2);
+
+        scene.tick();
+        SPC_CHECK (scene.system->getQueuedImpulseCount() == 0);
+
+        // Both are pushed by exactly one blast along the line between them, any more would double the speed.
+        const auto firstVelocity    = first->getVelocity();
+        const auto secondVelocity   = second->getVelocity();
+
+        SPC_CHECK (firstVelocity.x < -5.f && firstVelocity.x > -6.01f);
+        SPC_CHECK (secondVelocity.x > 5.f && secondVelocity.x < 6.01f);
+        SPC_CHECK (firstVelocity.x == -secondVelocity.x);
+        SPC_CHECK (std::abs (firstVelocity.y) < 1e-4f && std::abs (firstVelocity.z) < 1e-4f);
+        SPC_CHECK (std::abs (secondVelocity.y) < 1e-4f && std::abs (secondVelocity.z) < 1e-4f);
+
+        SPC_CHECK (isZero (wall->getVelocity()));
+        SPC_CHECK (isZero (far->getVelocity()));
+    }
+
+
+    /// <summary> Checks an impulse without a source pushes every object it reaches, even one at its centre. </summary>
+    void testWithoutSource()
+    {
+        Scene scene { };
+
+        const auto centre = math::Vector3 (0.f, 0.5f, 0.f);
+        auto sphere = scene.addSphere (centre);
+
+        scene.system->applyRadialImpulse (centre, 3.f, 6.f);
+        scene.tick();
+
+        // The sphere sits at the centre of the blast, which throws it upwards.
+        const auto velocity = sphere->getVelocity();
+        SPC_CHECK (velocity.y > 5.f);
+        SPC_CHECK (velocity.x == 0.f && velocity.z == 0.f);
+    }
+}
+
+
+/// <summary>
+/// Checks that queued radial impulses push every moving object within reach except the object causing each one, so
+/// blasts triggered in the same tick push each other's sources.
+/// </summary>
+int main()
+{
+    testSimultaneousBlasts();
+    testWithoutSource();
+
+    return test::finish ("RadialImpulseTests");
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// STL headers.
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+// Personal headers.
+#include <Utility/Misc.hpp>
+
+
+namespace
+{
+    /// <summary>
+    /// The original util::unorderedRemove, kept as the baseline. It swaps each removed object with the last one and
+    /// pops it, so every removal costs a swap and the condition is called through a std::function.
+    /// </summary>
+    template <typename T> void swapAndPopRemove (std::vector<T>& data, const std::function<bool (T&)>& condition)
+    {
+        assert (condition);
+        for (auto i = 0U; i < data.size(); ++i)
+        {
+            auto& element = data[i];
+            if (condition (element))
+            {
+                std::swap (element, data.back());
+                data.pop_back();
+                --i;
+            }
+        }
+    }
+
+
+    /// <summary> Times the best of several runs, each on a fresh copy of the data so the copy isn't timed. </summary>
+    /// <param name="data"> The values each run filters. </param>
+    /// <param name="remove"> Filters the copy it's given. </param>
+    /// <param name="kept"> Receives how many values the last run kept, which stops the work being optimised out. </param>
+    /// <returns> The fastest run in milliseconds. </returns>
+    template <typename Remove> double time (const std::vector<int>& data, const Remove& remove, std::size_t& kept)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        auto best = 0.0;
+
+        for (auto run = 0U; run < 5; ++run)
+        {
+            auto copy = data;
+
+            const auto start = Clock::now();
+            remove (copy);
+            const auto elapsed = std::chrono::duration<double, std::milli> (Clock::now() - start).count();
+
+            best = run == 0 ? elapsed : std::min (best, elapsed);
+            kept = copy.size();
+        }
+
+        return best;
+    }
+}
+
+
+/// <summary>
+/// Compares the original std::function swap-and-pop removal with util::unorderedRemove and util::stableRemove over
+/// vectors of 10k to 1M values and a range of removal ratios. Values are random so which objects are removed is
+/// unpredictable, as it is when the registry removes destroyed objects.
+/// </summary>
+int main()
+{
+    std::minstd_rand random (1);
+    std::uniform_int_distribution<int> value (0, 999);
+
+    std::printf ("%10s %7s %14s %14s %14s\n", "size", "removed", "swapAndPop ms", "unordered ms", "stable ms");
+
+    for (const auto size : { 10000U, 100000U, 1000000U })
+    {
+        std::vector<int> data (size);
+
+        for (auto& element : data)
+        {
+            element = value (random);
+        }
+
+        for (const auto ratio : { 0, 10, 100, 500, 900, 1000 })
+        {
+            const auto condition = [=] (const int& element) { return element < ratio; };
+
+            std::size_t baselineKept { 0 }, unorderedKept { 0 }, stableKept { 0 };
+
+            const auto baseline = time (data, [&] (std::vector<int>& copy)
+            {
+                swapAndPopRemove<int> (copy, condition);
+            }, baselineKept);
+
+            const auto unordered = time (data, [&] (std::vector<int>& copy)
+            {
+                util::unorderedRemove (copy, condition);
+            }, unorderedKept);
+
+            const auto stable = time (data, [&] (std::vector<int>& copy)
+            {
+                util::stableRemove (copy, condition);
+            }, stableKept);
+
+            if (baselineKept != unorderedKept || baselineKept != stableKept)
+            {
+                std::printf ("Removal functions disagree on %u values at %d/1000.\n", size, ratio);
+                return 1;
+            }
+
+            std::printf ("%10u %6.1f%% %14.3f %14.3f %14.3f\n", size, ratio / 10.f, baseline, unordered, stable);
+        }
+    }
+
+    return 0;
+}
\ No newline at end of file
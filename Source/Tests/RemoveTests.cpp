@@ -0,0 +1,180 @@
+// STL headers.
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+// Personal headers.
+#include <Tests/Check.hpp>
+#include <Utility/Misc.hpp>
+
+
+namespace
+{
+    /// <summary> Removes values with std::remove_if, which both util functions must agree with. </summary>
+    /// <param name="data"> The values to filter. </param>
+    /// <param name="condition"> Whether each value should be removed. </param>
+    /// <returns> The kept values in their original order. </returns>
+    template <typename Predicate> std::vector<int> reference (std::vector<int> data, const Predicate& condition)
+    {
+        data.erase (std::remove_if (data.begin(), data.end(), condition), data.end());
+        return data;
+    }
+
+
+    /// <summary> Sorts a copy of the values so vectors can be compared regardless of order. </summary>
+    /// <param name="data"> The values to sort. </param>
+    /// <returns> The sorted values. </returns>
+    std::vector<int> sorted (std::vector<int> data)
+    {
+        std::sort (data.begin(), data.end());
+        return data;
+    }
+
+
+    /// <summary>
+    /// Runs both functions on a copy of the data and checks the stable one matches std::remove_if exactly and the
+    /// unordered one keeps the same values. Each object must be tested exactly once as both work in a single pass.
+    /// </summary>
+    /// <param name="data"> The values to filter. </param>
+    /// <param name="condition"> Whether each value should be removed. </param>
+    template <typename Predicate> void checkRemoval (const std::vector<int>& data, const Predicate& condition)
+    {
+        const auto expected = reference (data, condition);
+        auto calls          = 0U;
+
+        const auto counted = [&] (const int value)
+        {
+            ++calls;
+            return condition (value);
+        };
+
+        auto stable = data;
+        util::stableRemove (stable, counted);
+        SPC_CHECK (stable == expected);
+        SPC_CHECK (calls == data.size());
+
+        calls = 0;
+        auto unordered = data;
+        util::unorderedRemove (unordered, counted);
+        SPC_CHECK (sorted (unordered) == sorted (expected));
+        SPC_CHECK (calls == data.size());
+    }
+
+
+    /// <summary> Creates the values 0 to count - 1 in order. </summary>
+    /// <param name="count"> How many values to create. </param>
+    /// <returns> The values. </returns>
+    std::vector<int> sequence (const int count)
+    {
+        std::vector<int> data (count);
+
+        for (auto i = 0; i < count; ++i)
+        {
+            data[i] = i;
+        }
+
+        return data;
+    }
+
+
+    /// <summary> Checks the edge cases: empty input, everything, nothing and runs at either end. </summary>
+    void testEdgeCases()
+    {
+        const auto everything   = [] (const int) { return true; };
+        const auto nothing      = [] (const int) { return false; };
+
+        // Empty vectors stay empty and nothing is tested.
+        checkRemoval ({ }, everything);
+        checkRemoval ({ }, nothing);
+
+        // Removing everything leaves an empty vector, removing nothing leaves it untouched.
+        for (const auto count : { 1, 2, 17, 1000 })
+        {
+            checkRemoval (sequence (count), everything);
+            checkRemoval (sequence (count), nothing);
+
+            auto unordered = sequence (count);
+            util::unorderedRemove (unordered, nothing);
+            SPC_CHECK (unordered == sequence (count));
+        }
+
+        // Runs at the front, at the back, at both ends, in the middle and alternating values.
+        const auto data = sequence (100);
+
+        checkRemoval (data, [] (const int value) { return value < 30; });
+        checkRemoval (data, [] (const int value) { return value >= 70; });
+        checkRemoval (data, [] (const int value) { return value < 10 || value >= 90; });
+        checkRemoval (data, [] (const int value) { return value >= 40 && value < 60; });
+        checkRemoval (data, [] (const int value) { return value % 2 == 0; });
+        checkRemoval (data, [] (const int value) { return value == 0; });
+        checkRemoval (data, [] (const int value) { return value == 99; });
+    }
+
+
+    /// <summary> Checks random vectors across removal ratios from none to all. </summary>
+    void testRandom()
+    {
+        std::minstd_rand random (7);
+        std::uniform_int_distribution<int> value (0, 999);
+
+        for (auto ratio = 0; ratio <= 1000; ratio += 125)
+        {
+            std::vector<int> data (500);
+
+            for (auto& element : data)
+            {
+                element = value (random);
+            }
+
+            checkRemoval (data, [=] (const int element) { return element < ratio; });
+        }
+    }
+
+
+    /// <summary> Checks objects which can only be moved are supported and the stable order is kept. </summary>
+    void testMoveOnly()
+    {
+        std::vector<std::unique_ptr<int>> stable { }, unordered { };
+
+        for (auto i = 0; i < 50; ++i)
+        {
+            stable.push_back (std::unique_ptr<int> (new int (i)));
+            unordered.push_back (std::unique_ptr<int> (new int (i)));
+        }
+
+        const auto odd = [] (const std::unique_ptr<int>& element) { return *element % 2 == 1; };
+
+        util::stableRemove (stable, odd);
+        util::unorderedRemove (unordered, odd);
+
+        SPC_CHECK (stable.size() == 25 && unordered.size() == 25);
+
+        for (auto i = 0U; i < stable.size(); ++i)
+        {
+            SPC_CHECK (stable[i] && *stable[i] == static_cast<int> (i * 2));
+        }
+
+        auto remaining = 0;
+
+        for (const auto& element : unordered)
+        {
+            SPC_CHECK (element && *element % 2 == 0);
+            remaining += element ? *element : 0;
+        }
+
+        SPC_CHECK (remaining == 600);
+    }
+}
+
+
+/// <summary> Checks util::unorderedRemove and util::stableRemove against std::remove_if. </summary>
+int main()
+{
+    testEdgeCases();
+    testRandom();
+    testMoveOnly();
+
+    return test::finish ("RemoveTests");
+}
\ No newline at end of file
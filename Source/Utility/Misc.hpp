@@ -3,8 +3,7 @@
 
 
 // STL headers.
-#include <cassert>
-#include <functional>
+#include <utility>
 #include <vector>
 
 
@@ -16,12 +15,21 @@ namespace util
     template <typename T> inline T squared (const T value);
 
     /// <summary> 
-    /// Removes any objects from the given vector provided the object meets the given condition. Removal of any object
-    /// will leave the elements in an undefined order.
+    /// Removes every object from the given vector which meets the given condition in a single pass. Each removed
+    /// object is replaced by moving one from the end of the vector, which avoids shifting the remaining objects but
+    /// leaves them in an undefined order.
     /// </summary>
     /// <param name="data"> The vector of objects to check. </param>
-    /// <param name="condition"> The predicate which indicates whether an object should be removed. </param>
-    template <typename T> void unorderedRemove (std::vector<T>& data, const std::function<bool (T&)>& condition);
+    /// <param name="condition"> Any callable taking T& which returns whether an object should be removed. </param>
+    template <typename T, typename Predicate> void unorderedRemove (std::vector<T>& data, const Predicate& condition);
+
+    /// <summary> 
+    /// Removes every object from the given vector which meets the given condition in a single pass, keeping the
+    /// remaining objects in their original order.
+    /// </summary>
+    /// <param name="data"> The vector of objects to check. </param>
+    /// <param name="condition"> Any callable taking T& which returns whether an object should be removed. </param>
+    template <typename T, typename Predicate> void stableRemove (std::vector<T>& data, const Predicate& condition);
 }
 
 
@@ -31,27 +39,52 @@ template <typename T> T util::squared (const T value)
 }
 
 
-template <typename T> void util::unorderedRemove (std::vector<T>& data, const std::function<bool (T&)>& condition)
+template <typename T, typename Predicate> void util::unorderedRemove (std::vector<T>& data, const Predicate& condition)
 {
-    // Pre-condition: Condition function is valid.
-    assert (condition);
+    // Everything from last onwards is either removed or has already been moved into a gap.
+    auto first = data.begin();
+    auto last  = data.end();
 
-    // Loop through each element.
-    for (auto i = 0U; i < data.size(); ++i)
+    while (first != last)
     {
-        // Cache the element.
-        auto& element = data[i];
+        if (condition (*first))
+        {
+            // Fill the gap with the last unchecked object, which is checked next. The last object doesn't need moving.
+            if (first != --last)
+            {
+                *first = std::move (*last);
+            }
+        }
 
-        // Swap and pop the element if the condition says so.
-        if (condition (element))
+        else
         {
-            std::swap (element, data.back());
-            data.pop_back();
+            ++first;
+        }
+    }
 
-            // Ensure we don't skip an object.
-            --i;
+    data.erase (last, data.end());
+}
+
+
+template <typename T, typename Predicate> void util::stableRemove (std::vector<T>& data, const Predicate& condition)
+{
+    // Objects being kept are moved forward over the removed ones.
+    auto write = data.begin();
+
+    for (auto read = data.begin(); read != data.end(); ++read)
+    {
+        if (!condition (*read))
+        {
+            if (write != read)
+            {
+                *write = std::move (*read);
+            }
+
+            ++write;
         }
     }
+
+    data.erase (write, data.end());
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "PoolAllocator.hpp"
+
+
+// STL headers.
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+
+namespace util
+{
+    const std::size_t PoolResource::blockAlignment;
+
+
+    // Blocks hold the free list pointer whilst unused, so they're never smaller than one.
+    static const auto minBlockSize = std::max (sizeof (void*), PoolResource::blockAlignment);
+
+
+    /////////////////////////////////
+    // Constructors and destructor //
+    /////////////////////////////////
+
+    PoolResource::PoolResource (const unsigned int blocksPerSlab)
+        : m_blocksPerSlab (std::max (blocksPerSlab, 1U))
+    {
+    }
+
+
+    PoolResource::~PoolResource()
+    {
+        for (auto& pool : m_pools)
+        {
+            // Every block should have been returned, otherwise something outlived the resource.
+            assert (pool.stats.used == 0);
+
+            for (const auto slab : pool.slabs)
+            {
+                ::operator delete (slab);
+            }
+        }
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    void* PoolResource::allocate (const std::size_t size)
+    {
+        auto& pool = poolFor (size);
+
+        if (!pool.free)
+        {
+            grow (pool);
+        }
+
+        // Pop the first free block.
+        const auto block = pool.free;
+        pool.free        = *static_cast<void**> (block);
+
+        pool.stats.used++;
+        pool.stats.peak = std::max (pool.stats.peak, pool.stats.used);
+
+        return block;
+    }
+
+
+    void PoolResource::deallocate (void* const block, const std::size_t size)
+    {
+        // Pre-condition: The block came from this resource.
+        assert (block);
+
+        auto& pool = poolFor (size);
+        assert (pool.stats.used > 0);
+
+        // Push the block onto the free list.
+        *static_cast<void**> (block) = pool.free;
+        pool.free                    = block;
+
+        pool.stats.used--;
+    }
+
+
+    void PoolResource::reserve (const std::size_t size, const unsigned int count)
+    {
+        auto& pool = poolFor (size);
+
+        while (pool.stats.capacity < count)
+        {
+            grow (pool);
+        }
+    }
+
+
+    std::vector<PoolResource::Stats> PoolResource::getStats() const
+    {
+        std::vector<Stats> stats { };
+        stats.reserve (m_pools.size());
+
+        for (const auto& pool : m_pools)
+        {
+            stats.push_back (pool.stats);
+        }
+
+        return stats;
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    PoolResource::Pool& PoolResource::poolFor (const std::size_t size)
+    {
+        // Round the size up so every block in a slab stays aligned.
+        const auto blockSize = std::max ((size + blockAlignment - 1) / blockAlignment * blockAlignment, minBlockSize);
+
+        // There are only ever a handful of sizes so a linear search is fastest.
+        for (auto& pool : m_pools)
+        {
+            if (pool.stats.blockSize == blockSize)
+            {
+                return pool;
+            }
+        }
+
+        m_pools.emplace_back();
+        m_pools.back().stats.blockSize = blockSize;
+
+        return m_pools.back();
+    }
+
+
+    void PoolResource::grow (Pool& pool)
+    {
+        // The heap only guarantees the alignment of a fundamental type, so extra space is left to align the first block.
+        const auto blockSize = pool.stats.blockSize;
+        const auto slab      = ::operator new (blockSize * m_blocksPerSlab + blockAlignment - 1);
+        const auto address   = reinterpret_cast<std::uintptr_t> (slab);
+        const auto first     = reinterpret_cast<unsigned char*> ((address + blockAlignment - 1) / blockAlignment * blockAlignment);
+
+        pool.slabs.push_back (slab);
+
+        // Thread the new blocks onto the front of the free list, keeping them in address order.
+        for (auto i = m_blocksPerSlab; i > 0; --i)
+        {
+            const auto block                    = first + (i - 1) * blockSize;
+            *reinterpret_cast<void**> (block)   = pool.free;
+            pool.free                           = block;
+        }
+
+        pool.stats.slabs++;
+        pool.stats.capacity += m_blocksPerSlab;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#ifndef UTILITY_POOL_ALLOCATOR_ASP_HPP
+#define UTILITY_POOL_ALLOCATOR_ASP_HPP
+
+
+// STL headers.
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+
+namespace util
+{
+    /// <summary>
+    /// Hands out fixed size blocks of memory from slabs which are only returned to the heap when the resource is
+    /// destroyed. Blocks of each size have their own free list, so once enough slabs exist allocating and freeing
+    /// objects never touches the heap. The resource isn't thread safe, it must only be used from one thread at a time.
+    /// </summary>
+    class PoolResource final
+    {
+        public:
+
+            /// <summary>
+            /// How much of the pool for one block size is in use.
+            /// </summary>
+            struct Stats final
+            {
+                std::size_t     blockSize   { 0 };  //!< The size of each block in bytes.
+                unsigned int    slabs       { 0 };  //!< How many slabs have been allocated from the heap.
+                unsigned int    capacity    { 0 };  //!< How many blocks the slabs contain.
+                unsigned int    used        { 0 };  //!< How many blocks are currently allocated.
+                unsigned int    peak        { 0 };  //!< The most blocks which have been allocated at once.
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            /// <summary> Construct an empty resource, slabs are only allocated once blocks are needed. </summary>
+            /// <param name="blocksPerSlab"> How many blocks each slab holds, at least one. </param>
+            PoolResource (const unsigned int blocksPerSlab = 64);
+
+            PoolResource (PoolResource&& move)                      = delete;
+            PoolResource& operator= (PoolResource&& move)           = delete;
+            PoolResource (const PoolResource& copy)                 = delete;
+            PoolResource& operator= (const PoolResource& copy)      = delete;
+            ~PoolResource();
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Takes a block from the pool of the given size, allocating a new slab if the pool is empty. </summary>
+            /// <param name="size"> How many bytes are needed. </param>
+            /// <returns> A block aligned to blockAlignment. </returns>
+            void* allocate (const std::size_t size);
+
+            /// <summary> Returns a block to the pool it was taken from. </summary>
+            /// <param name="block"> A block obtained from allocate. </param>
+            /// <param name="size"> The size which was passed to allocate. </param>
+            void deallocate (void* const block, const std::size_t size);
+
+            /// <summary> Ensures a number of blocks of the given size can be allocated without touching the heap. </summary>
+            /// <param name="size"> The size of the blocks. </param>
+            /// <param name="count"> How many blocks should be available in total. </param>
+            void reserve (const std::size_t size, const unsigned int count);
+
+            /// <summary> Gets the occupancy of every pool, in the order they were first needed. </summary>
+            /// <returns> One entry for each block size. </returns>
+            std::vector<Stats> getStats() const;
+
+            /// <summary> Every block is aligned to this many bytes, types which need more can't be pooled. </summary>
+            static const std::size_t blockAlignment = 16;
+
+        private:
+
+            /// <summary>
+            /// The slabs and free list of blocks of one size.
+            /// </summary>
+            struct Pool final
+            {
+                std::vector<void*>  slabs       { };            //!< The memory obtained from the heap.
+                void*               free        { nullptr };    //!< The first free block, which points to the next.
+                Stats               stats       { };            //!< How much of the pool is in use.
+            };
+
+
+            /// <summary> Finds the pool of the given block size, creating it if it doesn't exist yet. </summary>
+            Pool& poolFor (const std::size_t size);
+
+            /// <summary> Allocates a new slab for the pool and adds its blocks to the free list. </summary>
+            void grow (Pool& pool);
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<Pool>   m_pools         { };    //!< A pool for each block size which has been needed.
+            unsigned int        m_blocksPerSlab { 64 }; //!< How many blocks each new slab holds.
+    };
+
+
+    /// <summary>
+    /// A standard allocator which takes single objects from a shared PoolResource, intended for use with
+    /// std::allocate_shared. The object and its reference count share a block, and the control block keeps a copy of the
+    /// allocator so the resource lives until every object allocated from it has been freed. Arrays use the heap.
+    /// </summary>
+    template <typename T>
+    class PoolAllocator final
+    {
+        public:
+
+            using value_type = T;
+
+            template <typename U>
+            struct rebind final
+            {
+                using other = PoolAllocator<U>;
+            };
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            /// <summary> Construct an allocator which uses the given resource. </summary>
+            /// <param name="resource"> The resource to take blocks from. </param>
+            PoolAllocator (std::shared_ptr<PoolResource> resource);
+
+            /// <summary> Allows the allocator to be rebound to the control block of a shared_ptr. </summary>
+            template <typename U>
+            PoolAllocator (const PoolAllocator<U>& other);
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Allocates space for a number of objects. </summary>
+            /// <param name="count"> How many objects are needed, single objects are pooled. </param>
+            /// <returns> Uninitialised memory for the objects. </returns>
+            T* allocate (const std::size_t count);
+
+            /// <summary> Frees memory obtained from allocate. </summary>
+            /// <param name="pointer"> The memory to free. </param>
+            /// <param name="count"> The count which was passed to allocate. </param>
+            void deallocate (T* const pointer, const std::size_t count);
+
+            /// <summary> Gets the resource which blocks are taken from. </summary>
+            /// <returns> The shared resource. </returns>
+            const std::shared_ptr<PoolResource>& resource() const   { return m_resource; }
+
+        private:
+
+            std::shared_ptr<PoolResource> m_resource { nullptr }; //!< Where single objects are allocated from.
+    };
+
+
+    template <typename T, typename U>
+    bool operator== (const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs)
+    {
+        return lhs.resource() == rhs.resource();
+    }
+
+
+    template <typename T, typename U>
+    bool operator!= (const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+
+    /////////////////////
+    // Implementations //
+    /////////////////////
+
+    template <typename T>
+    PoolAllocator<T>::PoolAllocator (std::shared_ptr<PoolResource> resource)
+        : m_resource (std::move (resource))
+    {
+    }
+
+
+    template <typename T> template <typename U>
+    PoolAllocator<T>::PoolAllocator (const PoolAllocator<U>& other)
+        : m_resource (other.resource())
+    {
+    }
+
+
+    template <typename T>
+    T* PoolAllocator<T>::allocate (const std::size_t count)
+    {
+        static_assert (std::alignment_of<T>::value <= PoolResource::blockAlignment, "The type is too aligned to be pooled.");
+
+        if (count == 1)
+        {
+            return static_cast<T*> (m_resource->allocate (sizeof (T)));
+        }
+
+        return static_cast<T*> (::operator new (count * sizeof (T)));
+    }
+
+
+    template <typename T>
+    void PoolAllocator<T>::deallocate (T* const pointer, const std::size_t count)
+    {
+        if (count == 1)
+        {
+            m_resource->deallocate (pointer, sizeof (T));
+        }
+
+        else
+        {
+            ::operator delete (pointer);
+        }
+    }
+}
+
+#endif
\ No newline at end of file
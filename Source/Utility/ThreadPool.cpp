@@ -0,0 +1,205 @@
+#include "ThreadPool.hpp"
+
+
+// STL headers.
+#include <cassert>
+
+
+namespace util
+{
+    /////////////////////////////////
+    // Constructors and destructor //
+    /////////////////////////////////
+
+    ThreadPool::ThreadPool (const unsigned int workerCount)
+    {
+        setWorkerCount (workerCount);
+    }
+
+
+    ThreadPool::~ThreadPool()
+    {
+        stopWorkers();
+    }
+
+
+    //////////////////////
+    // Public interface //
+    //////////////////////
+
+    unsigned int ThreadPool::defaultWorkerCount()
+    {
+        const auto hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+
+    void ThreadPool::setWorkerCount (const unsigned int workerCount)
+    {
+        // Pre-condition: No batch is running.
+        assert (m_remaining == 0);
+
+        stopWorkers();
+
+        m_queues.clear();
+
+        for (auto i = 0U; i <= workerCount; ++i)
+        {
+            m_queues.emplace_back (new Queue());
+        }
+
+        m_stop = false;
+
+        for (auto i = 1U; i <= workerCount; ++i)
+        {
+            m_workers.emplace_back (&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+
+    void ThreadPool::parallelFor (const unsigned int count, const Task& task)
+    {
+        // Pre-condition: We have a task.
+        assert (task);
+
+        // It isn't worth waking anyone for a single task.
+        if (m_workers.empty() || count <= 1)
+        {
+            for (auto i = 0U; i < count; ++i)
+            {
+                task (i);
+            }
+
+            return;
+        }
+
+        // The task must be visible before any index is, a worker may still be looking for work from the last batch.
+        m_task      = &task;
+        m_remaining = count;
+
+        // Give each queue a contiguous block of the indices.
+        const auto queueCount = static_cast<unsigned int> (m_queues.size());
+
+        for (auto q = 0U; q < queueCount; ++q)
+        {
+            const auto begin = static_cast<unsigned int> (static_cast<unsigned long long> (count) * q / queueCount);
+            const auto end   = static_cast<unsigned int> (static_cast<unsigned long long> (count) * (q + 1) / queueCount);
+
+            std::lock_guard<std::mutex> lock (m_queues[q]->mutex);
+
+            for (auto i = begin; i < end; ++i)
+            {
+                m_queues[q]->tasks.push_back (i);
+            }
+        }
+
+        // Wake the workers.
+        {
+            std::lock_guard<std::mutex> lock (m_mutex);
+            ++m_batch;
+        }
+
+        m_wake.notify_all();
+
+        // Help out until every task has finished, not just been taken.
+        while (m_remaining > 0)
+        {
+            processTasks (0);
+            std::this_thread::yield();
+        }
+
+        m_task = nullptr;
+    }
+
+
+    //////////////
+    // Internal //
+    //////////////
+
+    void ThreadPool::workerLoop (const unsigned int queue)
+    {
+        auto seen = 0U;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock (m_mutex);
+                m_wake.wait (lock, [&] { return m_stop || m_batch != seen; });
+
+                if (m_stop)
+                {
+                    return;
+                }
+
+                seen = m_batch;
+            }
+
+            processTasks (queue);
+        }
+    }
+
+
+    void ThreadPool::processTasks (const unsigned int queue)
+    {
+        auto task = 0U;
+
+        while (takeTask (queue, task))
+        {
+            (*m_task) (task);
+            --m_remaining;
+        }
+    }
+
+
+    bool ThreadPool::takeTask (const unsigned int queue, unsigned int& task)
+    {
+        // Work from the back of our own queue.
+        {
+            auto& own = *m_queues[queue];
+            std::lock_guard<std::mutex> lock (own.mutex);
+
+            if (!own.tasks.empty())
+            {
+                task = own.tasks.back();
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+
+        // Steal from the front of everyone else's, furthest from where the owner is working.
+        const auto queueCount = static_cast<unsigned int> (m_queues.size());
+
+        for (auto offset = 1U; offset < queueCount; ++offset)
+        {
+            auto& other = *m_queues[(queue + offset) % queueCount];
+            std::lock_guard<std::mutex> lock (other.mutex);
+
+            if (!other.tasks.empty())
+            {
+                task = other.tasks.front();
+                other.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    void ThreadPool::stopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock (m_mutex);
+            m_stop = true;
+        }
+
+        m_wake.notify_all();
+
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+
+        m_workers.clear();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef UTILITY_THREAD_POOL_ASP_HPP
+#define UTILITY_THREAD_POOL_ASP_HPP
+
+
+// STL headers.
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace util
+{
+    /// <summary>
+    /// A pool of worker threads which execute batches of indexed tasks. Each thread, including the one which submits
+    /// the batch, owns a queue of tasks; once a thread runs out of work it steals from the front of another queue.
+    /// Tasks are handed out in contiguous blocks so threads tend to work on neighbouring data.
+    /// </summary>
+    class ThreadPool final
+    {
+        public:
+
+            /// <summary> A task which is given the index of the item to process. </summary>
+            using Task = std::function<void (const unsigned int)>;
+
+
+            /////////////////////////////////
+            // Constructors and destructor //
+            /////////////////////////////////
+
+            /// <summary> Construct a pool, spawning the given number of workers. </summary>
+            /// <param name="workerCount"> How many threads to spawn in addition to the submitting thread. </param>
+            ThreadPool (const unsigned int workerCount = defaultWorkerCount());
+
+            ThreadPool (ThreadPool&& move)                      = delete;
+            ThreadPool& operator= (ThreadPool&& move)           = delete;
+            ThreadPool (const ThreadPool& copy)                 = delete;
+            ThreadPool& operator= (const ThreadPool& copy)      = delete;
+            ~ThreadPool();
+
+
+            //////////////////////
+            // Public interface //
+            //////////////////////
+
+            /// <summary> Gets a sensible number of workers for the hardware, leaving a core for the submitting thread. </summary>
+            /// <returns> One less than the number of hardware threads, or zero if that is unknown. </returns>
+            static unsigned int defaultWorkerCount();
+
+            /// <summary> Gets how many threads are spawned in addition to the submitting thread. </summary>
+            /// <returns> The number of workers. </returns>
+            unsigned int getWorkerCount() const     { return static_cast<unsigned int> (m_workers.size()); }
+
+            /// <summary> Stops every worker and spawns the given number of new workers. This must not be called during a batch. </summary>
+            /// <param name="workerCount"> How many threads to spawn, zero causes every batch to run on the submitting thread. </param>
+            void setWorkerCount (const unsigned int workerCount);
+
+            /// <summary>
+            /// Calls the task once for every index in the range [0, count) and waits for every call to finish. The
+            /// order in which indices are processed is unspecified so each call must only modify data for its index.
+            /// </summary>
+            /// <param name="count"> How many indices to process. </param>
+            /// <param name="task"> The function to call with each index. </param>
+            void parallelFor (const unsigned int count, const Task& task);
+
+        private:
+
+            /// <summary>
+            /// The tasks waiting to be processed by a particular thread.
+            /// </summary>
+            struct Queue final
+            {
+                std::mutex                  mutex   { };    //!< Guards the tasks, held only whilst pushing or popping.
+                std::deque<unsigned int>    tasks   { };    //!< The indices waiting to be processed.
+            };
+
+
+            /// <summary> The function ran by each worker, sleeps until a batch is submitted and then helps to process it. </summary>
+            /// <param name="queue"> The index of the queue owned by the worker. </param>
+            void workerLoop (const unsigned int queue);
+
+            /// <summary> Processes tasks from the given queue, stealing from others once it is empty, until none remain. </summary>
+            /// <param name="queue"> The index of the queue owned by the calling thread. </param>
+            void processTasks (const unsigned int queue);
+
+            /// <summary> Takes the next task for a thread, first from the back of its own queue and then the front of others. </summary>
+            /// <param name="queue"> The index of the queue owned by the calling thread. </param>
+            /// <param name="task"> Set to the index of the task to be processed. </param>
+            /// <returns> Whether a task was found. </returns>
+            bool takeTask (const unsigned int queue, unsigned int& task);
+
+            /// <summary> Signals every worker to stop and waits for them to exit. </summary>
+            void stopWorkers();
+
+
+            ///////////////////
+            // Internal data //
+            ///////////////////
+
+            std::vector<std::thread>                m_workers       { };          //!< The spawned threads.
+            std::vector<std::unique_ptr<Queue>>     m_queues        { };          //!< One queue per worker plus one for the submitting thread at index 0.
+            const Task*                             m_task          { nullptr };  //!< The task of the current batch.
+            std::atomic<unsigned int>               m_remaining     { 0 };        //!< How many tasks of the current batch haven't finished.
+            std::mutex                              m_mutex         { };          //!< Guards the batch number and stop flag.
+            std::condition_variable                 m_wake          { };          //!< Notified when a batch is submitted or the workers should stop.
+            unsigned int                            m_batch         { 0 };        //!< Incremented every time a batch is submitted.
+            bool                                    m_stop          { false };    //!< Whether the workers should exit.
+    };
+}
+
+#endif
\ No newline at end of file
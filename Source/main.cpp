@@ -1,4 +1,6 @@
+#if defined (_MSC_VER)
 #include <crtdbg.h>
+#endif
 #include <cstdlib>
 
 #include <tyga/Application.hpp>
@@ -6,8 +8,10 @@
 
 int main(int argc, char *argv[])
 {
+#if defined (_MSC_VER)
     // enable debug memory checks
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
+#endif
 
     tyga::Application::run(std::make_shared<MyDemo>());
 